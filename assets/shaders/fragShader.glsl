@@ -3,11 +3,20 @@ in vec2 TexCoord;         // Receive from vertex shader
 out vec4 FragColor;       // Output color
 
 uniform sampler2D texture1;
+
+#ifdef INSTANCED
+in vec4 InstanceColor;    // Per-instance color from the vertex shader
+#else
 uniform vec3 objectColor; // Object color uniform
+#endif
 
 void main()
 {
     vec4 textureColor = texture(texture1, TexCoord);
+#ifdef INSTANCED
+    FragColor = InstanceColor * textureColor;
+#else
     // Mix texture with object color
     FragColor = vec4(objectColor, 1.0) * textureColor;
-}
\ No newline at end of file
+#endif
+}
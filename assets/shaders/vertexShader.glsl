@@ -3,6 +3,15 @@ layout(location = 0) in vec3 position;  // 3D position
 layout(location = 1) in vec2 texCoord;  // Texture coordinates
 layout(location = 2) in vec3 normal;    // Normal vector (for future lighting)
 
+#ifdef INSTANCED
+// Per-instance 2D transform and color, streamed by the GL core renderer
+layout(location = 3) in vec4 instanceBasis;   // Scaled rotation columns (x axis, y axis)
+layout(location = 4) in vec2 instanceOffset;  // Translation
+layout(location = 5) in vec4 instanceColor;   // Normalized RGBA8
+layout(location = 6) in vec4 instanceUv;      // Texture rectangle (u0, v0, u1, v1)
+out vec4 InstanceColor;
+#endif
+
 out vec2 TexCoord;  // Pass texture coordinates to fragment shader
 
 uniform mat4 model;       // Model transformation matrix
@@ -11,6 +20,17 @@ uniform mat4 projection;  // Projection matrix
 
 void main()
 {
+#ifdef INSTANCED
+    TexCoord = mix(instanceUv.xy, instanceUv.zw, texCoord);
+    InstanceColor = instanceColor;
+    mat4 instanceModel = mat4(
+        vec4(instanceBasis.xy, 0.0, 0.0),
+        vec4(instanceBasis.zw, 0.0, 0.0),
+        vec4(0.0, 0.0, 1.0, 0.0),
+        vec4(instanceOffset, 0.0, 1.0));
+    gl_Position = projection * view * instanceModel * vec4(position, 1.0);
+#else
     TexCoord = texCoord;
     gl_Position = projection * view * model * vec4(position, 1.0);
-}
\ No newline at end of file
+#endif
+}
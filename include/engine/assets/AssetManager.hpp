@@ -0,0 +1,248 @@
+#pragma once
+
+#include "engine/assets/VirtualFileSystem.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace parteeengine::events { class EventBus; }
+
+namespace parteeengine::assets {
+
+    // Asset concept: built from the raw file bytes on a loader thread, and able to
+    // report how much memory it holds so the manager can keep to its budget.
+    template<typename T>
+    concept AssetType = requires(std::string_view bytes, const std::string& path, const T& asset) {
+        { T::decode(bytes, path) } -> std::same_as<std::unique_ptr<T>>;
+        { asset.memoryUsage() } -> std::convertible_to<size_t>;
+    };
+
+    enum class AssetState : uint8_t {
+        Queued,
+        Loading,
+        Ready,
+        Failed
+    };
+
+    // Published on the engine event bus when a load finishes, successfully or not.
+    struct AssetLoadedEvent {
+        std::string path;
+        std::type_index type;
+        bool success;
+    };
+
+    namespace detail {
+
+        struct AssetStore;
+
+        // One cached asset. Owned by the store; handles keep it alive through refCount.
+        struct AssetSlot {
+            AssetSlot(std::string path, std::type_index type) : path(std::move(path)), type(type) {}
+            virtual ~AssetSlot() = default;
+
+            // Builds the asset from the file contents and sets bytes. May throw.
+            virtual void decode(std::string_view contents) = 0;
+
+            const std::string path;
+            const std::type_index type;
+            std::atomic<AssetState> state{AssetState::Queued};
+            std::atomic<uint32_t> refCount{0};
+            size_t bytes = 0;
+            std::string error; // Set before state becomes Failed
+
+            // Guarded by the store mutex
+            bool inLru = false;
+            std::list<AssetSlot*>::iterator lruPosition;
+        };
+
+        template<AssetType T>
+        struct TypedAssetSlot : AssetSlot {
+            using AssetSlot::AssetSlot;
+
+            void decode(std::string_view contents) override {
+                asset = T::decode(contents, path);
+                bytes = asset ? static_cast<size_t>(asset->memoryUsage()) : 0;
+            }
+
+            std::unique_ptr<T> asset;
+        };
+
+        // State shared by the manager, its loader threads and every handle, so
+        // handles stay valid even if they outlive the manager.
+        struct AssetStore {
+            struct Key {
+                std::type_index type;
+                std::string path;
+                bool operator==(const Key& other) const { return type == other.type && path == other.path; }
+            };
+            struct KeyHash {
+                size_t operator()(const Key& key) const {
+                    return std::hash<std::string>{}(key.path) ^ (key.type.hash_code() * 31);
+                }
+            };
+
+            // Adds a handle reference to a slot that may currently be unreferenced. Lock must be held.
+            void acquireLocked(AssetSlot* slot);
+            // Drops a handle reference. The last one is dropped under the lock, so a concurrent
+            // load() can't pick the slot up and have it evicted in between; the slot then becomes evictable.
+            void release(AssetSlot* slot);
+            // Blocks until the slot is Ready or Failed, loading it on this thread if no loader has picked it up yet.
+            void wait(AssetSlot* slot);
+            // Reads and decodes one slot, then publishes the result. Called without the lock.
+            void load(AssetSlot* slot);
+            // Evicts least recently released assets until usedBytes fits the budget. Lock must be held.
+            void evictLocked(size_t budget);
+
+            std::mutex mutex;
+            std::condition_variable workReady;
+            std::condition_variable loadFinished;
+            std::unordered_map<Key, std::unique_ptr<AssetSlot>, KeyHash> slots;
+            std::deque<AssetSlot*> queue;
+            std::list<AssetSlot*> lru; // Unreferenced finished assets, most recently released first
+            std::vector<AssetLoadedEvent> completed; // Since the last AssetManager::update
+            size_t usedBytes = 0;
+            size_t memoryBudget = 0;
+            bool stopping = false;
+
+            VirtualFileSystem fileSystem; // Has its own lock
+        };
+
+    } // namespace detail
+
+    // Reference-counted handle to an asset that may still be loading. Copies share
+    // the reference; the asset becomes evictable once the last handle is gone.
+    template<AssetType T>
+    class AssetHandle {
+    public:
+        AssetHandle() = default;
+        AssetHandle(const AssetHandle& other) : store(other.store), slot(other.slot) {
+            if (slot) slot->refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        AssetHandle(AssetHandle&& other) noexcept : store(std::move(other.store)), slot(std::exchange(other.slot, nullptr)) {}
+        AssetHandle& operator=(AssetHandle other) noexcept {
+            std::swap(store, other.store);
+            std::swap(slot, other.slot);
+            return *this;
+        }
+        ~AssetHandle() { reset(); }
+
+        void reset() {
+            if (slot) {
+                store->release(slot);
+            }
+            slot = nullptr;
+            store.reset();
+        }
+
+        bool isValid() const { return slot != nullptr; }
+        explicit operator bool() const { return isReady(); }
+
+        AssetState getState() const { return slot ? slot->state.load(std::memory_order_acquire) : AssetState::Failed; }
+        bool isReady() const { return getState() == AssetState::Ready; }
+        bool isFailed() const { return getState() == AssetState::Failed; }
+
+        // The asset, or nullptr while it is still loading or if loading failed.
+        const T* get() const { return isReady() ? slot->asset.get() : nullptr; }
+        const T* operator->() const { return get(); }
+
+        // Blocks until the load finishes. Returns nullptr if it failed.
+        const T* wait() const {
+            if (!slot) return nullptr;
+            store->wait(slot);
+            return get();
+        }
+
+        const std::string& getPath() const { return slot->path; }
+        // Why loading failed; only meaningful once isFailed().
+        const std::string& getError() const { return slot->error; }
+
+    private:
+        friend class AssetManager;
+
+        // Adopts a reference already counted by the manager.
+        AssetHandle(std::shared_ptr<detail::AssetStore> store, detail::TypedAssetSlot<T>* slot) : store(std::move(store)), slot(slot) {}
+
+        std::shared_ptr<detail::AssetStore> store;
+        detail::TypedAssetSlot<T>* slot = nullptr;
+    };
+
+    // Loads assets on background threads and caches them by (type, path).
+    // Requesting an asset that is already cached or in flight returns a handle to
+    // the same entry. Assets nobody holds a handle to stay cached until the total
+    // size exceeds the memory budget; then the least recently released ones are
+    // evicted. Referenced assets are never evicted, so the budget is soft.
+    class AssetManager {
+    public:
+        static constexpr size_t DefaultMemoryBudget = 256u * 1024u * 1024u;
+
+        explicit AssetManager(size_t loaderThreads = 2);
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        // Starts loading the asset in the background, or returns the cached entry. Never blocks on I/O.
+        template<AssetType T>
+        AssetHandle<T> load(const std::string& path);
+
+        // Publishes an AssetLoadedEvent for every load finished since the last call,
+        // and the cache size metrics. The engine calls this once per frame.
+        void update(events::EventBus* events);
+
+        AssetManager& setMemoryBudget(size_t bytes);
+        size_t getMemoryBudget() const;
+        size_t getMemoryUsage() const;
+        // Number of cached entries, including ones still loading.
+        size_t getAssetCount() const;
+        // Evicts every asset without handles, regardless of the budget.
+        void trim();
+
+        // Mounts an asset pack; its files shadow loose files and packs mounted earlier.
+        // Returns false if the pack can't be opened.
+        bool mount(const std::filesystem::path& packPath);
+        VirtualFileSystem& getFileSystem() { return store->fileSystem; }
+
+    private:
+        void loaderLoop();
+
+        std::shared_ptr<detail::AssetStore> store;
+        std::vector<std::thread> loaders;
+    };
+
+    template<AssetType T>
+    AssetHandle<T> AssetManager::load(const std::string& path) {
+        detail::AssetSlot* slot;
+        {
+            std::lock_guard<std::mutex> lock(store->mutex);
+            auto& entry = store->slots[detail::AssetStore::Key{std::type_index(typeid(T)), path}];
+            bool created = !entry;
+            if (created) {
+                entry = std::make_unique<detail::TypedAssetSlot<T>>(path, std::type_index(typeid(T)));
+                store->queue.push_back(entry.get());
+            }
+            slot = entry.get();
+            store->acquireLocked(slot);
+            if (created) {
+                store->workReady.notify_one();
+            }
+        }
+        return AssetHandle<T>(store, static_cast<detail::TypedAssetSlot<T>*>(slot));
+    }
+
+} // namespace parteeengine::assets
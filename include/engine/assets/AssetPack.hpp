@@ -0,0 +1,113 @@
+#pragma once
+
+#include "engine/util/MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace parteeengine::assets {
+
+    // Pack file layout (little-endian):
+    //   PackHeader
+    //   entry data, each entry starting on an EntryAlignment boundary
+    //   PackEntry[entryCount], sorted by pathHash   (at indexOffset)
+    //   path strings, not null-terminated           (at pathsOffset)
+    // The index and paths are read in place from the mapping; nothing is parsed at open.
+    namespace pack {
+        inline constexpr char Magic[4] = {'P', 'P', 'A', 'K'};
+        inline constexpr uint32_t Version = 1;
+        inline constexpr uint64_t EntryAlignment = 64;
+
+        inline constexpr uint32_t EntryCompressed = 1 << 0; // Data is one LZ4 block
+
+        struct PackHeader {
+            char magic[4];
+            uint32_t version;
+            uint64_t entryCount;
+            uint64_t indexOffset;
+            uint64_t pathsOffset;
+            uint64_t pathsSize;
+        };
+
+        struct PackEntry {
+            uint64_t pathHash;
+            uint64_t offset;       // Of the stored data, from the start of the file
+            uint64_t storedSize;   // Bytes in the pack
+            uint64_t originalSize; // Bytes after decompression
+            uint32_t pathOffset;   // Into the path strings
+            uint32_t pathLength;
+            uint32_t flags;
+            uint32_t reserved;
+        };
+
+        static_assert(sizeof(PackHeader) == 40);
+        static_assert(sizeof(PackEntry) == 48);
+
+        // FNV-1a over the normalized path: '\' counts as '/' and a leading "./" is ignored,
+        // so lookups match however the caller spells the path.
+        uint64_t hashPath(std::string_view path);
+        bool pathEquals(std::string_view normalized, std::string_view path);
+        std::string normalizePath(std::string_view path);
+    } // namespace pack
+
+    // Read-only view of a memory-mapped pack file.
+    class AssetPack {
+    public:
+        // Maps the pack and validates its header and index. Returns false if the file
+        // is missing, truncated or not a pack.
+        bool open(const std::filesystem::path& filePath);
+
+        // Binary search of the sorted index. Returns nullptr if the path isn't packed.
+        const pack::PackEntry* find(std::string_view path) const;
+
+        // The entry's bytes as stored: zero-copy contents unless the entry is compressed.
+        std::string_view stored(const pack::PackEntry& entry) const;
+        // Decompressed contents of the entry. Returns false if its data is corrupt.
+        bool read(const pack::PackEntry& entry, std::string& out) const;
+
+        std::string_view getPath(const pack::PackEntry& entry) const;
+        std::span<const pack::PackEntry> getEntries() const { return entries; }
+        const std::filesystem::path& getFilePath() const { return filePath; }
+
+    private:
+        MappedFile file;
+        std::filesystem::path filePath;
+        std::span<const pack::PackEntry> entries;
+        std::string_view paths;
+    };
+
+    // Builds pack files. Used by the offline packer tool; the engine only reads packs.
+    class AssetPackWriter {
+    public:
+        // Adds a file under the given pack path. Later additions replace earlier ones with the same path.
+        void add(std::string_view packPath, std::string contents);
+        // Adds every regular file under directory, with pack paths relative to base
+        // (e.g. base "." and directory "assets" gives "assets/scripts/x.par").
+        // Returns the number of files added.
+        size_t addDirectory(const std::filesystem::path& directory, const std::filesystem::path& base);
+
+        // Compresses entries with LZ4 when it saves at least minSavings of their size.
+        AssetPackWriter& setCompression(bool enabled, float minSavings = 0.1f);
+
+        // Returns false if the file can't be written.
+        bool write(const std::filesystem::path& outputPath) const;
+
+        size_t getEntryCount() const { return files.size(); }
+
+    private:
+        struct PendingFile {
+            std::string path; // Normalized
+            std::string contents;
+        };
+
+        std::vector<PendingFile> files;
+        bool compress = false;
+        float minSavings = 0.1f;
+    };
+
+} // namespace parteeengine::assets
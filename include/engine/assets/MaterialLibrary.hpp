@@ -0,0 +1,44 @@
+#pragma once
+
+#include "engine/util/Vector3.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace parteeengine::assets {
+
+    // One newmtl block of a Wavefront .mtl file.
+    struct Material {
+        std::string name;
+        Vector3 ambient{1.f, 1.f, 1.f};   // Ka
+        Vector3 diffuse{1.f, 1.f, 1.f};   // Kd
+        Vector3 specular{0.f, 0.f, 0.f};  // Ks
+        Vector3 emissive{0.f, 0.f, 0.f};  // Ke
+        float shininess = 0.f;            // Ns
+        float refractiveIndex = 1.f;      // Ni
+        float opacity = 1.f;              // d, or 1 - Tr
+        float roughness = 1.f;            // Pr (PBR extension)
+        int illuminationModel = 1;        // illum
+
+        // Texture paths as written in the file; not resolved or loaded
+        std::string ambientMap;           // map_Ka
+        std::string diffuseMap;           // map_Kd
+        std::string bumpMap;              // map_bump / bump
+    };
+
+    // Parsed .mtl file. Unknown statements are ignored.
+    struct MaterialLibrary {
+        std::vector<Material> materials;
+
+        // Throws std::runtime_error on malformed values.
+        static std::unique_ptr<MaterialLibrary> decode(std::string_view bytes, const std::string& path);
+
+        // Returns nullptr if the library has no material with that name.
+        const Material* find(std::string_view name) const;
+
+        size_t memoryUsage() const;
+    };
+
+} // namespace parteeengine::assets
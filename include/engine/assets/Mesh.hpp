@@ -0,0 +1,126 @@
+#pragma once
+
+#include "engine/util/MappedFile.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace parteeengine::assets {
+
+    // Interleaved vertex, laid out for direct upload to a vertex buffer.
+    struct MeshVertex {
+        float position[3];
+        float normal[3];  // Zero when the source has no normals
+        float uv[2];
+    };
+
+    // Range of the index buffer drawn with one material.
+    struct Submesh {
+        uint32_t indexOffset = 0;
+        uint32_t indexCount = 0;
+        std::string material; // usemtl name, empty if none
+    };
+
+    // Indexed triangle mesh. Loads from Wavefront .obj text or from a binary mesh
+    // cache (see MeshCache); decode picks by the file's magic bytes.
+    struct Mesh {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices; // Triangle list
+        std::vector<Submesh> submeshes;
+        std::string materialLibrary;   // mtllib path as written, relative to the .obj
+        float boundsMin[3] = {0.f, 0.f, 0.f};
+        float boundsMax[3] = {0.f, 0.f, 0.f};
+        // Unique per mesh built, unlike its address, which a later mesh may reuse. Renderers key GPU copies by it.
+        uint64_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+
+        // Throws std::runtime_error on malformed input.
+        static std::unique_ptr<Mesh> decode(std::string_view bytes, const std::string& path);
+
+        // Streams through OBJ text without copying lines. Polygons are fan-triangulated
+        // and identical position/uv/normal triples share one vertex.
+        static std::unique_ptr<Mesh> parseObj(std::string_view text, const std::string& path);
+
+        size_t memoryUsage() const;
+
+    private:
+        static inline std::atomic<uint64_t> nextId{1};
+    };
+
+    // Binary mesh cache: the parsed mesh stored exactly as it sits in memory, so
+    // loading it is a mapping plus pointer setup instead of text parsing.
+    //
+    // Layout (little-endian): Header, then vertices, indices, SubmeshRecords and
+    // the material name strings, each section aligned to 16 bytes.
+    class MeshCache {
+    public:
+        static constexpr char Magic[4] = {'P', 'M', 'S', 'H'};
+        static constexpr uint32_t Version = 1;
+
+        struct Header {
+            char magic[4];
+            uint32_t version;
+            uint64_t sourceStamp; // Identifies the source file version the cache was built from
+            uint32_t vertexCount;
+            uint32_t indexCount;
+            uint32_t submeshCount;
+            uint32_t stringsSize;
+            uint64_t vertexOffset;
+            uint64_t indexOffset;
+            uint64_t submeshOffset;
+            uint64_t stringsOffset;
+            float boundsMin[3];
+            float boundsMax[3];
+        };
+
+        struct SubmeshRecord {
+            uint32_t indexOffset;
+            uint32_t indexCount;
+            uint32_t materialOffset; // Into the strings; the mtllib path is stored at offset 0
+            uint32_t materialLength;
+        };
+
+        // Writes the mesh to cachePath. Returns false if the file can't be written.
+        static bool write(const Mesh& mesh, const std::filesystem::path& cachePath, uint64_t sourceStamp = 0);
+
+        // Stamp for a source file from its size and modification time; 0 if it doesn't exist.
+        static uint64_t stampFor(const std::filesystem::path& sourcePath);
+
+        // Loads objPath through its cache: uses cachePath when its stamp matches the .obj,
+        // otherwise parses the .obj and rewrites the cache. Returns nullptr if the .obj
+        // can't be read; parse errors throw.
+        static std::unique_ptr<Mesh> loadObj(const std::filesystem::path& objPath, const std::filesystem::path& cachePath);
+
+        // Maps a cache file and validates it. Returns false if it is missing or corrupt.
+        bool open(const std::filesystem::path& cachePath);
+        // Validates cache bytes that are already in memory, e.g. from a pack. The bytes must
+        // stay alive and unchanged while this view is used.
+        bool view(std::string_view bytes);
+
+        // Zero-copy views into the cache, valid while it stays open.
+        std::span<const MeshVertex> getVertices() const { return vertices; }
+        std::span<const uint32_t> getIndices() const { return indices; }
+        std::span<const SubmeshRecord> getSubmeshes() const { return submeshes; }
+        std::string_view getMaterial(const SubmeshRecord& submesh) const;
+        std::string_view getMaterialLibrary() const;
+        const Header& getHeader() const { return header; }
+
+        // Copies the cache into an owning Mesh.
+        std::unique_ptr<Mesh> toMesh() const;
+
+    private:
+        MappedFile file;
+        Header header{};
+        std::span<const MeshVertex> vertices;
+        std::span<const uint32_t> indices;
+        std::span<const SubmeshRecord> submeshes;
+        std::string_view strings;
+    };
+
+} // namespace parteeengine::assets
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace parteeengine::assets {
+
+    // Whole file as text; scripts, shader sources and other small text files.
+    struct TextAsset {
+        std::string text;
+
+        static std::unique_ptr<TextAsset> decode(std::string_view bytes, [[maybe_unused]] const std::string& path) {
+            return std::make_unique<TextAsset>(TextAsset{std::string(bytes)});
+        }
+
+        size_t memoryUsage() const { return sizeof(TextAsset) + text.capacity(); }
+    };
+
+} // namespace parteeengine::assets
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+
+namespace parteeengine::assets {
+
+    // Line and token reader for text asset formats (OBJ, MTL). Works on a view of
+    // the whole file and hands out views into it, so nothing is copied or
+    // allocated per line. Numbers are read with from_chars.
+    class TextScanner {
+    public:
+        explicit TextScanner(std::string_view text) : text(text) {}
+
+        // Moves to the next line. Returns false at the end of the text.
+        bool nextLine() {
+            if (position >= text.size()) {
+                return false;
+            }
+            size_t end = text.find('\n', position);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            line = text.substr(position, end - position);
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            position = end + 1;
+            ++lineNumber;
+            return true;
+        }
+
+        // Next whitespace-separated token of the current line, or an empty view.
+        std::string_view token() {
+            skipSpace();
+            size_t end = 0;
+            while (end < line.size() && !isSpace(line[end])) {
+                ++end;
+            }
+            std::string_view result = line.substr(0, end);
+            line.remove_prefix(end);
+            return result;
+        }
+
+        bool readFloat(float& out) {
+            skipSpace();
+            const char* first = line.data();
+            const char* last = line.data() + line.size();
+            if (first != last && *first == '+') {
+                ++first; // from_chars rejects an explicit plus sign
+            }
+            auto [end, error] = std::from_chars(first, last, out);
+            if (error != std::errc()) {
+                return false;
+            }
+            line.remove_prefix(static_cast<size_t>(end - line.data()));
+            return true;
+        }
+
+        bool readInt(int& out) {
+            skipSpace();
+            auto [end, error] = std::from_chars(line.data(), line.data() + line.size(), out);
+            if (error != std::errc()) {
+                return false;
+            }
+            line.remove_prefix(static_cast<size_t>(end - line.data()));
+            return true;
+        }
+
+        // Rest of the current line without surrounding whitespace; for names and paths that contain spaces.
+        std::string_view rest() {
+            skipSpace();
+            while (!line.empty() && isSpace(line.back())) {
+                line.remove_suffix(1);
+            }
+            std::string_view result = line;
+            line = {};
+            return result;
+        }
+
+        size_t getLineNumber() const { return lineNumber; }
+
+    private:
+        static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+        void skipSpace() {
+            while (!line.empty() && isSpace(line.front())) {
+                line.remove_prefix(1);
+            }
+        }
+
+        std::string_view text;
+        std::string_view line;  // Unconsumed part of the current line
+        size_t position = 0;    // Start of the next line
+        size_t lineNumber = 0;
+    };
+
+} // namespace parteeengine::assets
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "engine/assets/AssetPack.hpp"
+
+#include <filesystem>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace parteeengine::assets {
+
+    // Contents of one file read through the VirtualFileSystem. Uncompressed pack
+    // entries point straight into the pack's mapping, which this keeps alive;
+    // everything else is held in an owned buffer.
+    class FileData {
+    public:
+        std::string_view contents() const { return pack ? mapped : std::string_view(buffer); }
+
+    private:
+        friend class VirtualFileSystem;
+
+        std::shared_ptr<const AssetPack> pack;
+        std::string_view mapped;
+        std::string buffer;
+    };
+
+    // Resolves asset paths against mounted packs first, newest mount first, and
+    // falls back to loose files on disk. A pack lookup is a binary search over an
+    // index already in memory, so mounted assets cost no filesystem probing.
+    // Thread-safe; mounting while reads are in flight is allowed.
+    class VirtualFileSystem {
+    public:
+        // Maps a pack file. Returns false if it can't be opened or isn't a valid pack.
+        bool mount(const std::filesystem::path& packPath);
+        void unmountAll();
+        size_t getMountCount() const;
+
+        // Reads a file from the packs or, failing that, from disk. Returns false if neither has it.
+        bool read(std::string_view path, FileData& out) const;
+        bool exists(std::string_view path) const;
+
+        // Finds a loose file relative to the working directory or any of its parents,
+        // so assets/... paths work when running from a build directory.
+        // Returns an empty path if nothing matches.
+        static std::filesystem::path resolveLoosePath(const std::string& path);
+
+    private:
+        mutable std::shared_mutex mutex;
+        std::vector<std::shared_ptr<const AssetPack>> packs; // In mount order
+    };
+
+} // namespace parteeengine::assets
@@ -1,13 +1,20 @@
 #pragma once
 
+#include "engine/assets/AssetManager.hpp"
+#include "engine/assets/TextAsset.hpp"
 #include "engine/core/modules/ModuleManager.hpp"
 #include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/events/EventBus.hpp"
+#include "engine/core/replay/Replay.hpp"
 #include "engine/input/InputSystem.hpp"
 #include "engine/interpreter/Interpreter.hpp"
 #include "engine/interpreter/ObjectBuilder.hpp"
 
 #include <iostream>
 #include <ctime>
+#include <cstdint>
+#include <functional>
+#include <random>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -25,6 +32,7 @@ namespace parteeengine {
 
         interpreter::Value getEngineInterface();
 
+        // Starts loading the script in the background; it runs once all modules are initialized.
         void addScript(std::string script);
 
         // Gets a pointer to the module of type T, or nullptr if it doesn't exist.
@@ -39,20 +47,51 @@ namespace parteeengine {
         template<ComponentType T>
         T& addComponent(Entity entity);
 
+        // Events published by modules are delivered to subscribers once per frame, after the module updates.
+        events::EventBus& getEventBus() { return eventBus; }
+        assets::AssetManager& getAssetManager() { return assetManager; }
+
+        // Runs until a module or stop() ends the loop.
         void run();
+        // Runs at most frameCount frames. Useful for headless servers, tests and benchmarks.
+        void runFrames(uint64_t frameCount);
+        // Runs until the given wall-clock duration in seconds has elapsed.
+        void runFor(float seconds);
         void stop();
 
+        // Uses a constant delta time instead of wall-clock time when > 0.
+        void setFixedDeltaTime(float dt);
+
+        // Records each frame's input, dt and script random seed to a replay log during the next run.
+        bool recordReplay(const std::string& filePath);
+        // Drives the next run from a replay log instead of live input and wall-clock time.
+        // The run ends when the log does.
+        bool playReplay(const std::string& filePath);
+
     private:
+        // Publishes frame time and entity/component counts to the metrics registry.
+        void recordFrameMetrics();
+        // Shared main loop; stops when shouldStop(framesRun, secondsElapsed) returns true.
+        void runLoop(const std::function<bool(uint64_t, float)>& shouldStop);
+
         bool running = false; // Engine running state
         std::time_t lastFrameTime; // Time of the last frame, used for delta time calculation
-
-        ModuleInput moduleInput; // Input passed to modules each frame
+        float fixedDeltaTime = 0.f; // Constant dt override, disabled when 0
 
         EntityManager entityManager; // Manages entity creation and destruction
         ModuleManager moduleManager; // Manages engine modules
+        events::EventBus eventBus; // Batched events, dispatched at the end of each frame
+        assets::AssetManager assetManager; // Background asset loading and cache
+
+        ModuleInput moduleInput; // Input passed to modules each frame, refers to entityManager and eventBus
+
+        std::mt19937_64 seedSource{std::random_device{}()}; // Produces the per-frame script random seed
+        std::mt19937_64 scriptRandom; // Generator behind Engine.random(), reseeded every frame
+        replay::ReplayRecorder replayRecorder;
+        replay::ReplayPlayer replayPlayer;
 
         interpreter::Interpreter interpreter;  // Scripting interpreter 
-        std::vector<std::string> scripts; // List of script sources to execute
+        std::vector<assets::AssetHandle<assets::TextAsset>> scripts; // Scripts to execute, possibly still loading
     };
 
     template<EngineModule T>
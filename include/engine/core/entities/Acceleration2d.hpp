@@ -0,0 +1,18 @@
+#pragma once
+
+#include "engine/core/entities/Component.hpp"
+#include "engine/util/Vector2.hpp"
+
+namespace parteeengine {
+
+    // Constant acceleration applied to an entity's Velocity2d by KinematicsModule.
+    struct Acceleration2d : public ComponentCRTP<Acceleration2d> {
+        Vector2 linear{0.f, 0.f}; // Units per second squared
+        float angular = 0.f;      // Degrees per second squared
+
+        Acceleration2d() = default;
+        Acceleration2d(float x, float y, float angular = 0.f) : linear(x, y), angular(angular) {}
+        Acceleration2d(const Vector2& linear, float angular = 0.f) : linear(linear), angular(angular) {}
+    };
+
+} // namespace parteeengine
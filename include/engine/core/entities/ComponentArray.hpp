@@ -2,6 +2,7 @@
 
 #include "engine/core/entities/Entity.hpp"
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 #include <unordered_map>
@@ -19,6 +20,16 @@ namespace parteeengine {
 
         // Removes entity's component. No-op if entity doesn't have this component type.
         virtual void removeEntity(Entity entity) = 0;
+
+        // Number of entities that currently have this component.
+        virtual size_t size() const = 0;
+
+        // Incremented whenever a component is added or removed. Pointers into the
+        // array stay valid for as long as the version doesn't change.
+        uint64_t getVersion() const { return version; }
+
+    protected:
+        uint64_t version = 0;
     };
 
     // Typed, packed component storage. Uses swap-and-pop removal for O(1) delete.
@@ -29,7 +40,11 @@ namespace parteeengine {
 
         void removeEntity(Entity entity) override;
 
+        size_t size() const override { return components.size(); }
+
         T& get(Entity entity);
+        // Returns nullptr instead of throwing when entity has no component here.
+        T* tryGet(Entity entity);
 
         std::vector<T>& getComponents();
         const std::vector<T>& getComponents() const;
@@ -51,6 +66,7 @@ namespace parteeengine {
         components.push_back(T());
         indexToEntity.push_back(entity);
         entityToIndex[entity] = index;
+        ++version;
     }
 
     template<typename T>
@@ -71,6 +87,7 @@ namespace parteeengine {
         components.pop_back();
         indexToEntity.pop_back();
         entityToIndex.erase(it);
+        ++version;
     }
     
     template<typename T>
@@ -82,6 +99,15 @@ namespace parteeengine {
         return components[it->second];
     }
 
+    template<typename T>
+    T* ComponentArray<T>::tryGet(Entity entity) {
+        auto it = entityToIndex.find(entity);
+        if (it == entityToIndex.end()) {
+            return nullptr;
+        }
+        return &components[it->second];
+    }
+
     template<typename T>
     std::vector<T>& ComponentArray<T>::getComponents() { return components; }
 
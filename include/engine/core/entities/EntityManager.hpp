@@ -21,6 +21,11 @@ namespace parteeengine {
         void destroyEntity(const Entity entity);
         bool isValid(const Entity& entity) const;
 
+        // Number of live entities.
+        size_t getEntityCount() const;
+        // Number of components stored per component type.
+        std::vector<std::pair<std::type_index, size_t>> getComponentCounts() const;
+
         template<ComponentType T>
         T& addComponent(Entity entity);
 
@@ -36,6 +41,11 @@ namespace parteeengine {
         template<ComponentType T>
         std::vector<std::pair<Entity, T&>> getEntityComponentPairs() const;
 
+        // Structural version of T's component array (see VirtualComponentArray::getVersion).
+        // Returns 0 if no entity has ever had a T.
+        template<ComponentType T>
+        uint64_t getComponentVersion() const;
+
 
     private:
         std::vector<Generation> generations;  // Generation count for each entity ID
@@ -73,7 +83,7 @@ namespace parteeengine {
             return nullptr; // Return nullptr if entity doesn't have this component
         }
         auto* array = static_cast<ComponentArray<T>*>(it->second.get());
-        return &array->get(entity);
+        return array->tryGet(entity);
     }
 
     template<ComponentType T>
@@ -87,12 +97,7 @@ namespace parteeengine {
             return false;
         }
         auto* array = static_cast<ComponentArray<T>*>(it->second.get());
-        try {
-            array->get(entity);
-            return true;
-        } catch (const std::runtime_error&) {
-            return false;
-        }
+        return array->tryGet(entity) != nullptr;
     }   
 
     template<ComponentType T>
@@ -119,4 +124,13 @@ namespace parteeengine {
         return static_cast<ComponentArray<T>*>(it->second.get())->getEntityComponentPairs();
     }
 
+    template<ComponentType T>
+    uint64_t EntityManager::getComponentVersion() const {
+        auto it = entityComponents.find(T::getType());
+        if (it == entityComponents.end()) {
+            return 0;
+        }
+        return it->second->getVersion();
+    }
+
 } // namespace parteeengine
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "engine/core/entities/Component.hpp"
+#include "engine/util/Vector2.hpp"
+
+namespace parteeengine {
+
+    // Linear and angular velocity integrated into TransformComponent2d by KinematicsModule.
+    // Don't combine with physics::RigidBody2d, which PhysicsModule2d integrates itself.
+    struct Velocity2d : public ComponentCRTP<Velocity2d> {
+        Vector2 linear{0.f, 0.f}; // Units per second
+        float angular = 0.f;      // Degrees per second
+
+        Velocity2d() = default;
+        Velocity2d(float x, float y, float angular = 0.f) : linear(x, y), angular(angular) {}
+        Velocity2d(const Vector2& linear, float angular = 0.f) : linear(linear), angular(angular) {}
+    };
+
+} // namespace parteeengine
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/util/TypeName.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace parteeengine::events {
+
+    // Identifies a subscription so it can be removed again. 0 is never a valid id.
+    using SubscriptionId = uint64_t;
+
+    // Receives every event of one type published since the last dispatch, as a single batch.
+    template<typename E>
+    using EventHandler = std::function<void(std::span<const E>)>;
+
+    namespace detail {
+        // Process-wide counters, so ids stay unique across buses and never get reused.
+        inline std::atomic<uint32_t> nextEventTypeId{0};
+        inline std::atomic<uint32_t> nextQueueId{0};
+
+        template<typename E>
+        uint32_t eventTypeId() {
+            static const uint32_t id = nextEventTypeId.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+
+        // The calling thread's buffer per queue, indexed by queue id.
+        std::vector<void*>& threadSlots();
+    } // namespace detail
+
+    class IEventQueue {
+    public:
+        virtual ~IEventQueue() = default;
+
+        // Hands the pending batch to every subscriber, then empties it. Returns the batch size.
+        virtual size_t dispatch() = 0;
+        virtual bool unsubscribe(SubscriptionId id) = 0;
+        virtual const char* getName() const = 0;
+    };
+
+    // All events of type E. Every publishing thread appends to a buffer of its own,
+    // registered under a lock the first time that thread publishes; after that
+    // publishing is a plain vector append. dispatch() concatenates the thread buffers
+    // in registration order, so events from one thread keep their order.
+    template<typename E>
+    class EventQueue : public IEventQueue {
+    public:
+        EventQueue() : queueId(detail::nextQueueId.fetch_add(1, std::memory_order_relaxed)), name(readableTypeName(typeid(E))) {}
+
+        void publish(const E& event) { threadBuffer().push_back(event); }
+        void publish(E&& event) { threadBuffer().push_back(std::move(event)); }
+        void publish(std::span<const E> events) {
+            auto& buffer = threadBuffer();
+            buffer.insert(buffer.end(), events.begin(), events.end());
+        }
+        template<typename... Args>
+        void emplace(Args&&... args) { threadBuffer().emplace_back(std::forward<Args>(args)...); }
+
+        SubscriptionId subscribe(SubscriptionId id, EventHandler<E> handler) {
+            handlers.emplace_back(id, std::move(handler));
+            return id;
+        }
+
+        bool unsubscribe(SubscriptionId id) override {
+            for (auto& [handlerId, handler] : handlers) {
+                if (handlerId == id) {
+                    // Cleared rather than erased, so unsubscribing from inside a handler is safe
+                    handlerId = 0;
+                    handler = nullptr;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        size_t dispatch() override {
+            batch.clear();
+            for (auto& buffer : buffers) {
+                if (batch.empty()) {
+                    batch.swap(*buffer);
+                } else {
+                    batch.insert(batch.end(), std::make_move_iterator(buffer->begin()), std::make_move_iterator(buffer->end()));
+                    buffer->clear();
+                }
+            }
+            if (batch.empty()) {
+                return 0;
+            }
+
+            // Handlers added while dispatching see the next batch, not this one
+            std::span<const E> events(batch);
+            size_t handlerCount = handlers.size();
+            for (size_t i = 0; i < handlerCount; ++i) {
+                if (handlers[i].second) {
+                    handlers[i].second(events);
+                }
+            }
+            std::erase_if(handlers, [](const auto& entry) { return entry.first == 0; });
+            return events.size();
+        }
+
+        const char* getName() const override { return name; }
+
+    private:
+        std::vector<E>& threadBuffer() {
+            auto& slots = detail::threadSlots();
+            if (queueId >= slots.size()) {
+                slots.resize(queueId + 1, nullptr);
+            }
+            if (!slots[queueId]) {
+                std::lock_guard<std::mutex> lock(registryMutex);
+                buffers.push_back(std::make_unique<std::vector<E>>());
+                slots[queueId] = buffers.back().get();
+            }
+            return *static_cast<std::vector<E>*>(slots[queueId]);
+        }
+
+        const uint32_t queueId;
+        const char* name; // Readable name of E
+        std::mutex registryMutex;
+        std::vector<std::unique_ptr<std::vector<E>>> buffers; // One per publishing thread
+        std::vector<E> batch; // Merged events of the dispatch in progress
+        std::vector<std::pair<SubscriptionId, EventHandler<E>>> handlers;
+    };
+
+    // Typed, batched event bus. publish() may be called from any thread, including
+    // job system workers, and does not lock once the thread has published that type
+    // before. Subscribers are not called per event: dispatch() runs at a sync point
+    // (the engine calls it once per frame after the module updates) and hands each
+    // subscriber every pending event of its type as one span.
+    //
+    // subscribe(), unsubscribe() and dispatch() belong to the thread that owns the
+    // bus, and dispatch() must not overlap with publishers. Events published from a
+    // handler are delivered by the next dispatch.
+    class EventBus {
+    public:
+        static constexpr size_t MaxEventTypes = 256;
+
+        EventBus() = default;
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+
+        template<typename E>
+        void publish(const E& event) { getQueue<E>().publish(event); }
+        // Appends a whole batch, e.g. all contacts of a physics step.
+        template<typename E>
+        void publish(std::span<const E> events) { getQueue<E>().publish(events); }
+        template<typename E, typename... Args>
+        void emplace(Args&&... args) { getQueue<E>().emplace(std::forward<Args>(args)...); }
+
+        template<typename E>
+        SubscriptionId subscribe(EventHandler<E> handler) {
+            return getQueue<E>().subscribe(++lastSubscriptionId, std::move(handler));
+        }
+        bool unsubscribe(SubscriptionId id);
+
+        // Delivers every pending batch, one event type at a time in the order the
+        // types were first used. Returns the number of events delivered.
+        size_t dispatch();
+
+    private:
+        template<typename E>
+        EventQueue<E>& getQueue() {
+            uint32_t typeId = detail::eventTypeId<E>();
+            if (typeId >= MaxEventTypes) {
+                throw std::runtime_error("EventBus: too many event types");
+            }
+            IEventQueue* queue = queueTable[typeId].load(std::memory_order_acquire);
+            if (!queue) {
+                std::lock_guard<std::mutex> lock(queuesMutex);
+                queue = queueTable[typeId].load(std::memory_order_relaxed);
+                if (!queue) {
+                    queues.push_back(std::make_unique<EventQueue<E>>());
+                    queue = queues.back().get();
+                    queueTable[typeId].store(queue, std::memory_order_release);
+                }
+            }
+            return *static_cast<EventQueue<E>*>(queue);
+        }
+
+        std::array<std::atomic<IEventQueue*>, MaxEventTypes> queueTable{}; // Lock-free lookup by event type id
+        std::mutex queuesMutex;
+        std::vector<std::unique_ptr<IEventQueue>> queues; // Owns the queues, in creation order
+        SubscriptionId lastSubscriptionId = 0;
+    };
+
+} // namespace parteeengine::events
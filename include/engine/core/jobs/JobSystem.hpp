@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace parteeengine::jobs {
+
+    // Process-wide worker pool for data-parallel engine work. Workers start on
+    // first use. The calling thread always takes part in its own work, so nested
+    // parallelFor calls from a worker cannot deadlock.
+    class JobSystem {
+    public:
+        // Splits [0, count) into contiguous ranges of at least minBatchSize and runs
+        // fn(begin, end) for each across the workers and the caller. Blocks until all
+        // ranges are done. Runs inline when the work doesn't justify a split.
+        static void parallelFor(size_t count, size_t minBatchSize, const std::function<void(size_t, size_t)>& fn);
+
+        // Number of threads that can run work concurrently, including the caller.
+        static size_t getConcurrency();
+
+    private:
+        struct Pool {
+            Pool();
+            ~Pool();
+
+            void submit(std::function<void()> task);
+            void workerLoop();
+
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::deque<std::function<void()>> tasks;
+            std::vector<std::thread> workers;
+            bool stopping = false;
+        };
+
+        static Pool& pool();
+    };
+
+} // namespace parteeengine::jobs
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace parteeengine::metrics {
+
+    // Percentile snapshot of a rolling window.
+    struct Summary {
+        double p50 = 0;
+        double p95 = 0;
+        double p99 = 0;
+        double max = 0;
+        uint64_t count = 0; // Total samples ever observed, not just the window
+    };
+
+    // Keeps the most recent WindowSize samples. Percentiles are computed on query,
+    // so observing is a single store.
+    class RollingWindow {
+    public:
+        static constexpr size_t WindowSize = 1024;
+
+        void add(double value) {
+            samples[count % WindowSize] = value;
+            ++count;
+        }
+
+        Summary summarize() const;
+
+    private:
+        std::array<double, WindowSize> samples{};
+        uint64_t count = 0;
+    };
+
+    // Process-wide metrics registry. Series are identified by a metric name plus a
+    // preformatted Prometheus label set (see label()). All calls are thread-safe.
+    class Metrics {
+    public:
+        // Formats a single label pair, escaping the value, e.g. module="Render".
+        static std::string label(const std::string& key, const std::string& value);
+
+        // Adds a sample to a rolling summary series (timings, sizes, ...).
+        static void observe(const std::string& name, double value, const std::string& labels = "");
+        // Sets a gauge series to an absolute value.
+        static void setGauge(const std::string& name, double value, const std::string& labels = "");
+
+        // Returns an empty summary if the series doesn't exist.
+        static Summary getSummary(const std::string& name, const std::string& labels = "");
+        // Returns 0 if the gauge doesn't exist.
+        static double getGauge(const std::string& name, const std::string& labels = "");
+
+        // Drops every series.
+        static void clear();
+
+        // Writes all series in the Prometheus text exposition format.
+        // Returns false if the file cannot be written.
+        static bool writePrometheus(const std::string& filePath);
+
+    private:
+        using SeriesKey = std::pair<std::string, std::string>; // name, labels
+
+        static inline std::mutex mutex;
+        static inline std::map<SeriesKey, RollingWindow> summaries;
+        static inline std::map<SeriesKey, double> gauges;
+    };
+
+    // Metric names recorded by the engine itself.
+    namespace names {
+        inline constexpr const char* FrameTime = "partee_frame_time_seconds";
+        inline constexpr const char* ModuleUpdateTime = "partee_module_update_seconds";
+        inline constexpr const char* ComponentCount = "partee_component_count";
+        inline constexpr const char* EntityCount = "partee_entity_count";
+        inline constexpr const char* RenderCommandCount = "partee_render_command_count";
+        inline constexpr const char* EventCount = "partee_event_count";
+        inline constexpr const char* AssetMemory = "partee_asset_memory_bytes";
+        inline constexpr const char* AssetCount = "partee_asset_count";
+        inline constexpr const char* DrawCalls = "partee_draw_calls";
+    } // namespace names
+
+} // namespace parteeengine::metrics
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "engine/core/modules/Module.hpp"
+#include "engine/core/entities/Acceleration2d.hpp"
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/core/entities/Velocity2d.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace parteeengine {
+
+    // Integrates every entity with a Velocity2d and a TransformComponent2d using
+    // semi-implicit Euler (velocity first, then position). Component pointers are
+    // cached until one of the involved component arrays changes structurally, and
+    // entities are integrated in SIMD blocks, optionally across worker threads.
+    class KinematicsModule : public Module {
+    public:
+        ~KinematicsModule() override = default;
+
+        bool initialize(const ModuleInput& input) override;
+        bool update(const ModuleInput& input) override;
+
+        // Splits integration across the job system when there are enough entities.
+        KinematicsModule& setThreaded(bool threaded);
+
+    private:
+        struct Binding {
+            Transform2d* transform;
+            Velocity2d* velocity;
+            const Acceleration2d* acceleration; // nullptr if the entity has none
+        };
+
+        void refreshBindings(const EntityManager& entityManager);
+        void integrateRange(size_t begin, size_t end, float dt);
+
+        bool threaded = true;
+        std::vector<Binding> bindings;
+
+        // Component array versions the bindings were built against
+        uint64_t transformVersion = 0;
+        uint64_t velocityVersion = 0;
+        uint64_t accelerationVersion = 0;
+        bool bindingsValid = false;
+    };
+
+} // namespace parteeengine
@@ -3,11 +3,13 @@
 namespace parteeengine {
 
     class EntityManager;
+    namespace events { class EventBus; }
 
     // Data passed to modules each frame.
     struct ModuleInput {
         const EntityManager& entityManager;
         float dt = 0; // Delta time since last frame
+        events::EventBus* events = nullptr; // Engine event bus, delivered once per frame after all module updates
     };
 
     // Base class for all engine modules. Modules are the primary extension point
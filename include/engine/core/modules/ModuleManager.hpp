@@ -1,6 +1,7 @@
 #pragma once
 
 #include "engine/core/modules/Module.hpp"
+#include "engine/util/TypeName.hpp"
 
 #include <unordered_map>
 #include <typeindex>
@@ -25,7 +26,12 @@ namespace parteeengine {
         bool updateModules(const ModuleInput& inputs);
 
     private:
-        std::unordered_map<std::type_index, std::unique_ptr<Module>> modules; // Map of module type to module instance
+        struct Entry {
+            std::unique_ptr<Module> module;
+            const char* name; // Readable name of the module type, for profiler zones and metric labels
+        };
+
+        std::unordered_map<std::type_index, Entry> modules; // Map of module type to module instance
     };
 
     template<EngineModule T>
@@ -33,15 +39,15 @@ namespace parteeengine {
         if (modules.find(typeid(T)) != modules.end()) {
             throw std::runtime_error("Module of this type already exists");
         }
-        modules.emplace(typeid(T), std::make_unique<T>());
-        return *static_cast<T*>(modules[typeid(T)].get());
+        auto [it, inserted] = modules.emplace(typeid(T), Entry{std::make_unique<T>(), readableTypeName(typeid(T))});
+        return *static_cast<T*>(it->second.module.get());
     }
 
     template<EngineModule T>
     T* ModuleManager::getModule() {
         auto it = modules.find(typeid(T));
         if (it != modules.end()) {
-            return static_cast<T*>(it->second.get());
+            return static_cast<T*>(it->second.module.get());
         }
         return nullptr;
     }
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace parteeengine::profiling {
+
+    // A single completed zone. Names must have static storage duration
+    // (string literals or std::type_info::name()).
+    struct ProfileEvent {
+        const char* name = nullptr;
+        uint64_t startNs = 0;
+        uint64_t endNs = 0;
+    };
+
+    // Single-producer ring buffer owned by one thread. The owning thread writes
+    // without locking; readers snapshot the head and skip entries that may have
+    // been overwritten while they were reading.
+    class ProfileRingBuffer {
+    public:
+        static constexpr size_t Capacity = 1 << 16; // Must be a power of two
+
+        explicit ProfileRingBuffer(uint32_t threadId) : threadId(threadId) {}
+
+        void push(const ProfileEvent& event) {
+            uint64_t h = head.load(std::memory_order_relaxed);
+            events[h & (Capacity - 1)] = event;
+            head.store(h + 1, std::memory_order_release);
+        }
+
+        // Copies the retained events (oldest first) into out.
+        void snapshot(std::vector<ProfileEvent>& out) const;
+
+        void clear() { tail.store(head.load(std::memory_order_acquire), std::memory_order_release); }
+
+        uint32_t getThreadId() const { return threadId; }
+
+    private:
+        std::array<ProfileEvent, Capacity> events{};
+        std::atomic<uint64_t> head{0};  // Total events ever written
+        std::atomic<uint64_t> tail{0};  // Events before this index have been cleared
+        uint32_t threadId;
+    };
+
+    // Process-wide scoped-zone profiler. Each thread records into its own ring
+    // buffer; buffers are only registered (under a lock) the first time a thread
+    // records. Export is intended to run at a sync point, e.g. between frames.
+    class Profiler {
+    public:
+        static uint64_t now() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        static void setEnabled(bool value) { enabled.store(value, std::memory_order_relaxed); }
+        static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+        static void record(const char* name, uint64_t startNs, uint64_t endNs) {
+            threadBuffer().push(ProfileEvent{name, startNs, endNs});
+        }
+
+        // Drops all recorded events on every thread.
+        static void clear();
+
+        // Writes every retained event as Chrome trace / Perfetto compatible JSON.
+        // Returns false if the file cannot be opened.
+        static bool exportChromeTrace(const std::string& filePath);
+
+    private:
+        static ProfileRingBuffer& threadBuffer();
+
+        static inline std::atomic<bool> enabled{true};
+        static inline std::mutex registryMutex;
+        static inline std::vector<std::unique_ptr<ProfileRingBuffer>> buffers;
+    };
+
+    // RAII zone. Records [construction, destruction) into the calling thread's buffer.
+    class ScopedZone {
+    public:
+        explicit ScopedZone(const char* name) : name(name), startNs(Profiler::isEnabled() ? Profiler::now() : 0) {}
+        ~ScopedZone() {
+            if (startNs != 0) {
+                Profiler::record(name, startNs, Profiler::now());
+            }
+        }
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+
+    private:
+        const char* name;
+        uint64_t startNs;
+    };
+
+} // namespace parteeengine::profiling
+
+#define PARTEE_PROFILE_CONCAT_INNER(a, b) a##b
+#define PARTEE_PROFILE_CONCAT(a, b) PARTEE_PROFILE_CONCAT_INNER(a, b)
+
+#ifndef PARTEE_DISABLE_PROFILING
+#define PARTEE_PROFILE_ZONE(name) ::parteeengine::profiling::ScopedZone PARTEE_PROFILE_CONCAT(profileZone_, __LINE__)(name)
+#else
+#define PARTEE_PROFILE_ZONE(name) ((void)0)
+#endif
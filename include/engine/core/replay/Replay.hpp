@@ -0,0 +1,66 @@
+#pragma once
+
+#include "engine/input/InputSystem.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace parteeengine::replay {
+
+    // Everything needed to reproduce one engine frame.
+    struct ReplayFrame {
+        float dt = 0.f;
+        uint64_t randomSeed = 0; // Seed of the script-visible random generator for this frame
+        std::vector<input::InputSample> inputs;
+    };
+
+    // Binary log layout (host byte order):
+    //   header:  "PRPL" magic, uint32 version
+    //   records: uint8 tag followed by
+    //     DeviceRecord: uint16 length, name bytes (assigned the next device index)
+    //     FrameRecord:  float dt, uint64 seed, uint16 count, count * (uint16 device, uint16 id, uint16 deviceIndex, float value)
+    namespace format {
+        inline constexpr char Magic[4] = {'P', 'R', 'P', 'L'};
+        inline constexpr uint32_t Version = 1;
+        inline constexpr uint8_t DeviceRecord = 1;
+        inline constexpr uint8_t FrameRecord = 2;
+    } // namespace format
+
+    // Streams frames to a replay log as they complete.
+    class ReplayRecorder {
+    public:
+        // Returns false if the file cannot be created.
+        bool open(const std::string& filePath);
+        void close();
+        bool isOpen() const { return file.is_open(); }
+
+        void recordFrame(const ReplayFrame& frame);
+
+    private:
+        uint16_t deviceIndex(std::string_view device);
+
+        std::ofstream file;
+        std::unordered_map<std::string_view, uint16_t> deviceIndices; // Keys point at type_info::name() storage
+    };
+
+    // Reads frames back from a replay log in order.
+    class ReplayPlayer {
+    public:
+        // Returns false if the file is missing or not a replay log.
+        bool open(const std::string& filePath);
+        void close();
+        bool isOpen() const { return file.is_open(); }
+
+        // Reads the next frame. Returns false at the end of the log or on a malformed record.
+        bool nextFrame(ReplayFrame& frame);
+
+    private:
+        std::ifstream file;
+        std::deque<std::string> deviceNames; // Deque keeps sample string_views stable as names are added
+    };
+
+} // namespace parteeengine::replay
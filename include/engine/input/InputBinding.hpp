@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <typeindex>
 
 namespace parteeengine::input {
 
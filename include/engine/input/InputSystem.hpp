@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <mutex>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -8,6 +10,21 @@
 #include "InputBinding.hpp"
 
 namespace parteeengine::input {
+
+    // One binding value observed during a frame. Device is identified by its
+    // type name so samples can be written to and read back from replay logs.
+    struct InputSample {
+        std::string_view device; // Must outlive the sample (type_info::name() or replay-owned storage)
+        BindingID id;
+        uint16_t deviceIndex;
+        float value;
+    };
+
+    enum class InputMode {
+        Live,       // Query devices directly
+        Recording,  // Query devices and remember every value observed this frame
+        Replaying   // Answer queries from the injected frame state, never touch devices
+    };
     
     class InputSystem {
     public:
@@ -20,9 +37,22 @@ namespace parteeengine::input {
         template<typename DeviceType>
         static void registerDevice();
 
+        static void setMode(InputMode newMode);
+        static InputMode getMode() { return mode; }
+
+        // Values observed (Recording) or injected (Replaying) for the current frame.
+        static const std::vector<InputSample>& getFrameState() { return frameState; }
+        static void setFrameState(std::vector<InputSample> state);
+
     private:
+        static const InputSample* findSample(const InputBinding& binding);
+        static void storeSample(const InputBinding& binding, float value);
+
         static inline std::unordered_map<DeviceType, std::vector<std::unique_ptr<VirtualInputDevice>>> devices;
 
+        static inline InputMode mode = InputMode::Live;
+        static inline std::vector<InputSample> frameState; // Few entries per frame; searched linearly
+
     };
 
     template<typename DeviceType>
@@ -30,4 +60,4 @@ namespace parteeengine::input {
         devices[typeid(DeviceType)].push_back(std::make_unique<DeviceType>());
     }
 
-} // namespace parteeengine::input
\ No newline at end of file
+} // namespace parteeengine::input
@@ -103,7 +103,10 @@ namespace interpreter {
     public:
         Interpreter(const parteeengine::Engine* enginePtr) : engine(enginePtr) {}
 
+        // Loads the .par file at the given path and runs it.
         void interpret(const std::string& source);
+        // Runs script code that has already been loaded.
+        void interpretSource(const std::string& code);
 
         void ExposeObject(const std::string& name, const Value& value);
 
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "engine/core/entities/Component.hpp"
+#include "engine/particles/ParticlePool.hpp"
+#include "engine/util/Color.hpp"
+#include "engine/util/Vector2.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace parteeengine::particles {
+
+    // Spawns particles at the entity's TransformComponent2d position. Particles
+    // are not entities; they live in the emitter's pool, which ParticleModule
+    // allocates on first update.
+    struct ParticleEmitter : public ComponentCRTP<ParticleEmitter> {
+        size_t capacity = 4096;          // Maximum live particles
+        float rate = 100.f;              // Particles per second
+        bool emitting = true;
+
+        float minLifetime = 0.5f;        // Seconds
+        float maxLifetime = 1.f;
+        float minSpeed = 50.f;
+        float maxSpeed = 100.f;
+        float direction = -90.f;         // Degrees; -90 points up in screen space
+        float spread = 360.f;            // Full cone angle in degrees
+        Vector2 acceleration{0.f, 0.f};  // Applied to every particle, e.g. gravity
+        Vector2 offset{0.f, 0.f};        // Spawn point relative to the transform
+
+        Color startColor{1.f, 1.f, 1.f, 1.f};
+        Color endColor{1.f, 1.f, 1.f, 0.f};
+        float size = 4.f;                // Rendered quad edge length
+
+        // State of the emitter's random stream. 0 derives it from the entity on the first
+        // update, so emitters spawned together differ; set it for a stream that doesn't
+        // depend on entity ids, e.g. for deterministic replays.
+        uint32_t seed = 0;
+
+        std::unique_ptr<ParticlePool> pool; // Created by ParticleModule
+        float spawnAccumulator = 0.f;       // Fractional particles carried between frames
+
+        ParticleEmitter() = default;
+        ParticleEmitter(float rate, size_t capacity = 4096) : capacity(capacity), rate(rate) {}
+    };
+
+} // namespace parteeengine::particles
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "engine/core/modules/Module.hpp"
+#include "engine/particles/ParticleEmitter.hpp"
+
+namespace parteeengine::particles {
+
+    // Spawns, simulates and retires the particles of every ParticleEmitter.
+    // Emitters are independent, so they are updated across the job system;
+    // each pool is simulated with SIMD and compacted in place.
+    class ParticleModule : public Module {
+    public:
+        ~ParticleModule() override = default;
+
+        bool initialize(const ModuleInput& input) override;
+        bool update(const ModuleInput& input) override;
+
+    private:
+        static void spawn(ParticleEmitter& emitter, float originX, float originY, float dt);
+        static void simulate(ParticleEmitter& emitter, float dt);
+    };
+
+} // namespace parteeengine::particles
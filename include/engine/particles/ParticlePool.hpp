@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace parteeengine::particles {
+
+    // Fixed-capacity structure-of-arrays particle storage. Arrays are allocated
+    // once and never reallocated, so render commands can point straight into
+    // them. Live particles are always packed into [0, count).
+    struct ParticlePool {
+        explicit ParticlePool(size_t capacity);
+
+        // Removes particles whose life ran out by moving the last live particle
+        // into each hole. Order is not preserved.
+        void compact();
+
+        size_t capacity;
+        size_t count = 0;
+
+        // Each array holds capacity entries, rounded up to a whole SIMD block
+        std::unique_ptr<float[]> posX, posY;
+        std::unique_ptr<float[]> velX, velY;
+        std::unique_ptr<float[]> r, g, b, a;
+        std::unique_ptr<float[]> life;            // Seconds left
+        std::unique_ptr<float[]> inverseLifetime; // 1 / total lifetime, for color interpolation
+    };
+
+} // namespace parteeengine::particles
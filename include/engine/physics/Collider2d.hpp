@@ -0,0 +1,48 @@
+#pragma once
+
+#include "engine/core/entities/Component.hpp"
+#include "engine/util/Vector2.hpp"
+
+#include <cstdint>
+
+namespace parteeengine::physics {
+
+    enum class ColliderShape : uint8_t {
+        AABB,   // Axis-aligned box, ignores transform rotation
+        Circle,
+        OBB     // Box rotated by the transform rotation
+    };
+
+    // Collision shape centered on the entity's TransformComponent2d position plus offset.
+    struct Collider2d : public ComponentCRTP<Collider2d> {
+        ColliderShape shape = ColliderShape::AABB;
+        Vector2 halfExtents{50.f, 50.f}; // Box shapes; the default matches the default quad scale
+        float radius = 50.f;             // Circle shape
+        Vector2 offset{0.f, 0.f};
+        bool isTrigger = false;          // Triggers report contacts but are never resolved
+
+        Collider2d() = default;
+
+        static Collider2d box(const Vector2& halfExtents) {
+            Collider2d collider;
+            collider.shape = ColliderShape::AABB;
+            collider.halfExtents = halfExtents;
+            return collider;
+        }
+
+        static Collider2d orientedBox(const Vector2& halfExtents) {
+            Collider2d collider;
+            collider.shape = ColliderShape::OBB;
+            collider.halfExtents = halfExtents;
+            return collider;
+        }
+
+        static Collider2d circle(float radius) {
+            Collider2d collider;
+            collider.shape = ColliderShape::Circle;
+            collider.radius = radius;
+            return collider;
+        }
+    };
+
+} // namespace parteeengine::physics
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "engine/core/entities/Entity.hpp"
+#include "engine/util/Vector2.hpp"
+
+namespace parteeengine::physics {
+
+    // A touching pair found during a physics step.
+    struct Contact2d {
+        Entity a;
+        Entity b;
+        Vector2 normal;    // Unit vector pointing from a towards b
+        float penetration; // Overlap depth along normal
+        bool isTrigger;    // Either collider is a trigger; the pair was not resolved
+    };
+
+} // namespace parteeengine::physics
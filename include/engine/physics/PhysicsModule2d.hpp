@@ -0,0 +1,83 @@
+#pragma once
+
+#include "engine/core/modules/Module.hpp"
+#include "engine/core/entities/Entity.hpp"
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/physics/Collider2d.hpp"
+#include "engine/physics/Contact2d.hpp"
+#include "engine/physics/RigidBody2d.hpp"
+#include "engine/physics/SweepAndPrune2d.hpp"
+#include "engine/util/Vector2.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace parteeengine::physics {
+
+    // Simulates every entity with a Collider2d and a TransformComponent2d.
+    // Each step integrates bodies, finds pairs with sweep-and-prune, runs the
+    // narrowphase (SIMD for box/box and circle/circle), then solves contact
+    // islands in parallel. All contacts of a step are exposed as one batch and
+    // published to the engine event bus as Contact2d events.
+    class PhysicsModule2d : public Module {
+    public:
+        ~PhysicsModule2d() override = default;
+
+        bool initialize(const ModuleInput& input) override;
+        bool update(const ModuleInput& input) override;
+
+        PhysicsModule2d& setGravity(const Vector2& gravity);
+        PhysicsModule2d& setSolverIterations(int iterations);
+
+        // Contacts found by the last step, including trigger overlaps.
+        const std::vector<Contact2d>& getContacts() const { return contacts; }
+
+    private:
+        // Internal contact between two proxies.
+        struct ProxyContact {
+            uint32_t a;
+            uint32_t b;
+            float normalX;
+            float normalY;
+            float penetration;
+            bool isTrigger;
+        };
+
+        void gatherProxies(const EntityManager& entityManager);
+        void integrate(float dt);
+        void updateBounds();
+        void narrowphase();
+        void collideGeneric(uint32_t a, uint32_t b);
+        void buildIslands();
+        void solveIsland(size_t island);
+        void writeBack(float dt);
+
+        Vector2 gravity{0.f, 0.f};
+        int solverIterations = 4;
+
+        // Proxy state, one entry per collider, structure-of-arrays
+        std::vector<Entity> entities;
+        std::vector<TransformComponent2d*> transforms;
+        std::vector<const Collider2d*> colliders;
+        std::vector<RigidBody2d*> bodies; // nullptr for static colliders
+        std::vector<float> posX, posY, velX, velY;
+        std::vector<float> inverseMass, restitution, friction;
+        std::vector<float> rotation; // Radians
+        std::vector<float> halfX, halfY, radius;
+        std::vector<ColliderShape> shapes;
+        std::vector<uint8_t> triggers;
+
+        SweepAndPrune2d broadphase;
+        std::vector<ProxyPair> pairs;
+        std::vector<ProxyPair> boxPairs, circlePairs;
+        std::vector<ProxyContact> proxyContacts;
+
+        // Islands: contacts of island i are islandContacts[islandOffsets[i] .. islandOffsets[i + 1])
+        std::vector<uint32_t> islandParent;
+        std::vector<uint32_t> islandOffsets;
+        std::vector<uint32_t> islandContacts;
+
+        std::vector<Contact2d> contacts;
+    };
+
+} // namespace parteeengine::physics
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "engine/core/entities/Component.hpp"
+#include "engine/util/Vector2.hpp"
+
+namespace parteeengine::physics {
+
+    // Dynamic state for an entity simulated by PhysicsModule2d. Entities with a
+    // Collider2d but no RigidBody2d are treated as static geometry.
+    struct RigidBody2d : public ComponentCRTP<RigidBody2d> {
+        Vector2 velocity{0.f, 0.f};
+        float angularVelocity = 0.f; // Degrees per second, matching Transform2d::rotation
+        float mass = 1.f;            // A mass of 0 makes the body static
+        float restitution = 0.2f;    // Bounciness, combined with the other body by taking the minimum
+        float friction = 0.4f;       // Coulomb friction, combined by geometric mean
+        float gravityScale = 1.f;
+
+        RigidBody2d() = default;
+        RigidBody2d(float mass) : mass(mass) {}
+        RigidBody2d(const Vector2& velocity, float mass = 1.f) : velocity(velocity), mass(mass) {}
+
+        float inverseMass() const { return mass > 0.f ? 1.f / mass : 0.f; }
+    };
+
+} // namespace parteeengine::physics
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace parteeengine::physics {
+
+    using ProxyPair = std::pair<uint32_t, uint32_t>;
+
+    // Incremental sweep-and-prune broadphase over structure-of-arrays bounds.
+    // Proxies are plain indices; the sort order along x is kept between frames,
+    // so coherent motion re-sorts in close to linear time.
+    class SweepAndPrune2d {
+    public:
+        // Resizes the proxy set. Changing the count invalidates the cached order.
+        void setProxyCount(size_t count);
+        size_t getProxyCount() const { return minX.size(); }
+
+        void setBounds(uint32_t proxy, float minX, float minY, float maxX, float maxY) {
+            this->minX[proxy] = minX;
+            this->minY[proxy] = minY;
+            this->maxX[proxy] = maxX;
+            this->maxY[proxy] = maxY;
+        }
+
+        // Replaces pairs with every overlapping proxy pair (touching counts as overlapping).
+        void findPairs(std::vector<ProxyPair>& pairs);
+
+    private:
+        void sortAxis();
+
+        std::vector<float> minX, minY, maxX, maxY;  // Indexed by proxy
+        std::vector<uint32_t> order;                // Proxies sorted by minX, reused next frame
+        bool orderValid = false;
+
+        // Bounds gathered in sort order and padded with sentinels, so the sweep
+        // can always load a full SIMD block past the last proxy.
+        std::vector<float> sortedMinX, sortedMinY, sortedMaxY;
+    };
+
+} // namespace parteeengine::physics
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "engine/rendering/renderables/QuadRenderCommand.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // Interleaved vertex of a batched quad.
+    struct QuadVertex {
+        float x, y;
+        float u, v;
+        uint32_t color; // RGBA8, red in the lowest byte
+    };
+
+    // Run of consecutive quads drawn with the same state in one draw call.
+    struct QuadBatch {
+        uint32_t firstQuad;
+        uint32_t quadCount;
+        uint32_t texture;
+    };
+
+    // Turns quad commands into one vertex stream plus a list of draw batches,
+    // without touching a graphics API. Corners are transformed on the CPU with
+    // SIMD, four quads at a time, and large frames are split across the job system.
+    //
+    // A batch ends when the texture changes or it reaches the batch size limit.
+    // Each quad uses four vertices, so one shared 16-bit index pattern covers every
+    // batch: draw batch i with the vertex pointer at vertices[firstQuad * 4].
+    class QuadBatchBuilder {
+    public:
+        static constexpr uint32_t MaxQuadsPerBatch = 65536 / 4; // Keeps indices 16-bit
+
+        // Rebuilds vertices and batches for the commands, in order. Buffers are reused across calls.
+        void build(std::span<const QuadRenderCommand> commands);
+
+        const std::vector<QuadVertex>& getVertices() const { return vertices; }
+        // Index pattern for up to the largest batch built so far: quad q is (4q, 4q+1, 4q+2, 4q+2, 4q+3, 4q).
+        const std::vector<uint16_t>& getIndices() const { return indices; }
+        const std::vector<QuadBatch>& getBatches() const { return batches; }
+
+        QuadBatchBuilder& setMaxQuadsPerBatch(uint32_t quads);
+        QuadBatchBuilder& setThreaded(bool threaded);
+
+        static uint32_t packColor(const Color& color);
+
+    private:
+        // Writes the vertices of commands [begin, end).
+        void transform(std::span<const QuadRenderCommand> commands, size_t begin, size_t end);
+        void ensureIndices(uint32_t quads);
+
+        std::vector<QuadVertex> vertices;
+        std::vector<uint16_t> indices;
+        std::vector<QuadBatch> batches;
+        uint32_t maxQuadsPerBatch = MaxQuadsPerBatch;
+        bool threaded = true;
+    };
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/rendering/core/Culling.hpp"
+#include "engine/rendering/core/RenderTrace.hpp"
+#include "engine/rendering/renderables/QuadRenderCommand.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace parteeengine {
+    class EntityManager;
+} // namespace parteeengine
+
+namespace parteeengine::rendering {
+
+    struct RenderQuadComponent;
+
+    // Static quads sharing a sort key and a grid cell, baked into commands once.
+    struct StaticQuadBatch {
+        std::vector<QuadRenderCommand> quads; // In entity order
+        uint64_t sortKey = 0;
+        uint64_t version = 0; // Unique per build; renderers key data they derive from quads by it
+        CullBounds bounds;    // Around every quad, however it is rotated
+    };
+
+    // Draws a whole batch; handlers draw its quads as if each had been emitted on its own.
+    struct StaticQuadBatchCommand {
+        const StaticQuadBatch* batch;
+    };
+
+    template<>
+    struct RenderTraceTraits<StaticQuadBatchCommand> {
+        static void encode(StaticQuadBatchCommand& command, RenderTraceWriter& writer) {
+            command.batch = reinterpret_cast<const StaticQuadBatch*>(uintptr_t(writer.addQuadBatch(*command.batch)));
+        }
+        static bool decode(StaticQuadBatchCommand& command, const RenderTraceReader& reader) {
+            command.batch = reader.getQuadBatch(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(command.batch)));
+            return command.batch != nullptr;
+        }
+    };
+
+    // Splits the quads into retained batches of static ones and a list of dynamic
+    // ones. A quad or transform component being added or removed rebuilds both.
+    // Otherwise each update compares every static quad with the command its batch
+    // baked, a few loads per quad, and rebuilds only the batches that a changed
+    // quad leaves or joins; a dynamic quad being flagged static joins its batch the
+    // same way. Batches that aren't rebuilt keep their version, so renderers keep
+    // what they derived from them.
+    class StaticQuadCache {
+    public:
+        // Static quads are grouped into square cells of this many world units, so batches
+        // off screen can be culled as a whole.
+        static constexpr float CellSize = 1024.f;
+
+        struct DynamicQuad {
+            const RenderQuadComponent* component;
+            const Transform2d* transform;
+        };
+
+        // Rebuilds whatever is out of date. Returns true if a batch or the dynamic list changed.
+        bool update(const EntityManager& entityManager);
+
+        // Valid until the next update(). A batch emptied by changes stays, empty and with
+        // empty bounds, until the next full rebuild.
+        const std::vector<DynamicQuad>& getDynamicQuads() const { return dynamicQuads; }
+        const std::vector<StaticQuadBatch>& getBatches() const { return batches; }
+        // Full rebuilds, and batches rebuilt on their own between them
+        uint64_t getRebuildCount() const { return rebuildCount; }
+        uint64_t getBatchRebuildCount() const { return batchRebuildCount; }
+
+    private:
+        static constexpr uint32_t Dynamic = UINT32_MAX;
+
+        // A quad with a transform. Entries are in entity order, and so are the quads of a batch.
+        struct Entry {
+            const RenderQuadComponent* component;
+            const Transform2d* transform;
+            uint32_t batch; // Index in batches, or Dynamic
+            uint32_t slot;  // Index of its command in the batch's quads
+        };
+
+        void rebuild(const EntityManager& entityManager);
+        // Index of the batch quad belongs in, added if there is none yet.
+        uint32_t batchFor(const RenderQuadComponent& quad, const Transform2d& transform);
+        // Refills the batches marked dirty from their entries and gives them new versions. Returns how many.
+        size_t rebuildDirtyBatches();
+        void rebuildDynamicQuads();
+
+        std::vector<Entry> entries;
+        std::vector<DynamicQuad> dynamicQuads;
+        std::vector<StaticQuadBatch> batches;
+        std::vector<uint8_t> dirtyBatches; // Parallel to batches
+        std::map<std::tuple<uint64_t, int64_t, int64_t>, uint32_t> batchIndices; // By sort key and cell
+        uint64_t quadVersion = 0;
+        uint64_t transformVersion = 0;
+        uint64_t rebuildCount = 0;
+        uint64_t batchRebuildCount = 0;
+        bool built = false;
+
+        static inline std::atomic<uint64_t> nextBatchVersion{1};
+    };
+
+} // namespace parteeengine::rendering
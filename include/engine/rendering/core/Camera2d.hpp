@@ -0,0 +1,53 @@
+#pragma once
+
+#include "engine/core/entities/Component.hpp"
+#include "engine/rendering/core/Culling.hpp"
+#include "engine/util/Vector2.hpp"
+
+#include <cmath>
+
+namespace parteeengine::rendering {
+
+    // Part of the window a camera draws into, as fractions of the window size.
+    // The origin is the top left corner, like the rest of screen space.
+    struct Viewport {
+        float x = 0.f;
+        float y = 0.f;
+        float width = 1.f;
+        float height = 1.f;
+    };
+
+    // 2D camera. position is the world point shown at the center of the viewport;
+    // one world unit covers zoom pixels. The render module uses the first camera
+    // it finds. Without one, world coordinates are window pixels.
+    struct Camera2d : public ComponentCRTP<Camera2d> {
+        Vector2 position{0.f, 0.f};
+        float zoom = 1.f;
+        float rotation = 0.f; // In degrees, like Transform2d
+        Viewport viewport;
+
+        Camera2d() = default;
+        Camera2d(const Vector2& position, float zoom = 1.f) : position(position), zoom(zoom) {}
+    };
+
+    // What a frame is seen through, resolved against the window size. Gatherers
+    // cull against visible; renderers set up their viewport and view from it.
+    struct RenderView {
+        // Viewport in window pixels, origin top left
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+        // World to viewport pixels, column major, origin at the viewport's top left
+        float view[16] = {1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f};
+        CullBounds visible;
+
+        // Pixels one world unit spans, whichever way the view is rotated
+        float getPixelsPerUnit() const { return std::hypot(view[0], view[1]); }
+
+        static RenderView fromCamera(const Camera2d& camera, int windowWidth, int windowHeight);
+        // World coordinates are window pixels.
+        static RenderView screen(int windowWidth, int windowHeight);
+    };
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "engine/util/Simd.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace parteeengine::rendering {
+
+    // World-space rectangle that is on screen.
+    struct CullBounds {
+        float minX = 0.f;
+        float minY = 0.f;
+        float maxX = 0.f;
+        float maxY = 0.f;
+    };
+
+    inline bool overlaps(const CullBounds& a, const CullBounds& b) {
+        return a.maxX >= b.minX && a.minX <= b.maxX && a.maxY >= b.minY && a.minY <= b.maxY;
+    }
+
+    // Writes the index of every box that may overlap bounds to visible, in order, and
+    // returns how many it wrote. Box i is centered on (x[i], y[i]) with half extents
+    // (halfX[i], halfY[i]) and may be rotated any way: it is tested by its bounding
+    // circle, so a few boxes just off a corner pass. visible must hold count indices.
+    inline size_t cullBoxes(const CullBounds& bounds, const float* x, const float* y, const float* halfX, const float* halfY,
+                            size_t count, uint32_t* visible) {
+        size_t written = 0;
+        size_t i = 0;
+        const simd::Float4 minX = simd::set1(bounds.minX);
+        const simd::Float4 minY = simd::set1(bounds.minY);
+        const simd::Float4 maxX = simd::set1(bounds.maxX);
+        const simd::Float4 maxY = simd::set1(bounds.maxY);
+        for (; i + simd::Width <= count; i += simd::Width) {
+            simd::Float4 hx = simd::load(halfX + i);
+            simd::Float4 hy = simd::load(halfY + i);
+            simd::Float4 radius = simd::sqrt(hx * hx + hy * hy);
+            simd::Float4 px = simd::load(x + i);
+            simd::Float4 py = simd::load(y + i);
+            simd::Mask4 inside = (px + radius >= minX) & (px - radius <= maxX) & (py + radius >= minY) & (py - radius <= maxY);
+            for (unsigned mask = static_cast<unsigned>(simd::bitmask(inside)); mask != 0; mask &= mask - 1) {
+                visible[written++] = static_cast<uint32_t>(i + std::countr_zero(mask));
+            }
+        }
+        for (; i < count; ++i) {
+            float radius = std::sqrt(halfX[i] * halfX[i] + halfY[i] * halfY[i]);
+            if (x[i] + radius >= bounds.minX && x[i] - radius <= bounds.maxX && y[i] + radius >= bounds.minY && y[i] - radius <= bounds.maxY) {
+                visible[written++] = static_cast<uint32_t>(i);
+            }
+        }
+        return written;
+    }
+
+} // namespace parteeengine::rendering
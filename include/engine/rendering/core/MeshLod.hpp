@@ -0,0 +1,42 @@
+#pragma once
+
+#include "engine/assets/AssetManager.hpp"
+#include "engine/assets/Mesh.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // Meshes of one model from most to least detailed, e.g. Duck_LOD0.obj, Duck_LOD1.obj, ...
+    // Level i + 1 takes over once the model spans fewer than screenSizes[i] pixels across,
+    // so screenSizes holds one fewer entry than levels and should be decreasing. Shared by
+    // every instance of the model.
+    struct MeshLodChain {
+        static constexpr size_t MaxLevels = 8;
+
+        std::vector<assets::AssetHandle<assets::Mesh>> levels;
+        std::vector<float> screenSizes;
+        // Fraction a model's size must pass a threshold by before its level changes, so
+        // instances hovering around one don't flip between levels every frame.
+        float hysteresis = 0.1f;
+
+        // Appends a coarser level, drawn below screenSize pixels. The first level's is ignored.
+        MeshLodChain& addLevel(assets::AssetHandle<assets::Mesh> mesh, float screenSize = 0.f);
+        MeshLodChain& setHysteresis(float fraction);
+
+        size_t getLevelCount() const { return levels.size(); }
+
+        // Mesh for level, or the nearest level that is loaded if it isn't yet, looking at
+        // coarser levels first. Writes the level it found to drawn. nullptr if none are ready.
+        const assets::Mesh* resolve(uint8_t level, uint8_t& drawn) const;
+    };
+
+    // Picks a level of chain for each of count instances, four at a time. Instance i spans
+    // 2 * hypot(halfX[i], halfY[i]) world units and drew levels[i] last frame; levels[i] is
+    // overwritten with the level to draw now. pixelsPerUnit converts world units to pixels.
+    void selectLods(const MeshLodChain& chain, float pixelsPerUnit, const float* halfX, const float* halfY,
+                    float* levels, size_t count);
+
+} // namespace parteeengine::rendering
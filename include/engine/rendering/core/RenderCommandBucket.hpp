@@ -1,16 +1,120 @@
 #pragma once
 
-#include <vector>
+#include "engine/util/LinearArena.hpp"
+#include "engine/util/TypeName.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
 
 namespace parteeengine::rendering {
 
+    // Commands of one type with a sort key each. Buckets live as long as their
+    // frame and are reset between frames; the commands and keys are carved from
+    // the frame's arena, so after the first frames gathering doesn't allocate.
     struct IRenderCommandBucket {
+        IRenderCommandBucket(LinearArena& arena, const char* name) : arena(&arena), name(name) {}
         virtual ~IRenderCommandBucket() = default;
+
+        virtual std::type_index getType() const = 0;
+        // The command type's readable name, for profiler zones and metric labels.
+        const char* getName() const { return name; }
+        // Rearranges commands and keys so that position i holds the old element order[i].
+        virtual void reorder(std::span<const uint32_t> order) = 0;
+        // Drops every command. Must be called before the arena is reset.
+        virtual void reset() = 0;
+
+        size_t size() const { return count; }
+        std::span<const uint64_t> getKeys() const { return {keys, count}; }
+
+    protected:
+        LinearArena* arena;
+        const char* name;
+        uint64_t* keys = nullptr;
+        size_t count = 0;
+        size_t capacity = 0;
+        size_t lastCount = 0; // Commands of the previous frame, reserved up front
     };
 
     template<typename CommandType>
     struct RenderCommandBucket : public IRenderCommandBucket {
-        std::vector<CommandType> commands;
+        // Arena memory is reused without running destructors and grown with memcpy
+        static_assert(std::is_trivially_copyable_v<CommandType> && std::is_trivially_destructible_v<CommandType>,
+            "Render commands must be trivially copyable and destructible");
+
+        explicit RenderCommandBucket(LinearArena& arena) : IRenderCommandBucket(arena, readableTypeName(typeid(CommandType))) {}
+
+        // Constructs the command in place from args.
+        template<typename... Args>
+        CommandType& emplace(uint64_t sortKey, Args&&... args) {
+            if (count == capacity) {
+                grow(count + 1);
+            }
+            keys[count] = sortKey;
+            return *std::construct_at(commands + count++, std::forward<Args>(args)...);
+        }
+
+        // Copies commands and their keys to the end of the bucket.
+        void append(std::span<const CommandType> newCommands, std::span<const uint64_t> newKeys) {
+            if (newCommands.empty()) {
+                return;
+            }
+            reserve(count + newCommands.size());
+            std::memcpy(commands + count, newCommands.data(), newCommands.size_bytes());
+            std::memcpy(keys + count, newKeys.data(), newKeys.size_bytes());
+            count += newCommands.size();
+        }
+
+        void reserve(size_t minimumCapacity) {
+            if (minimumCapacity > capacity) {
+                grow(minimumCapacity);
+            }
+        }
+
+        std::span<const CommandType> getCommands() const { return {commands, count}; }
+        std::type_index getType() const override { return typeid(CommandType); }
+
+        void reorder(std::span<const uint32_t> order) override {
+            CommandType* sortedCommands = arena->allocate<CommandType>(order.size());
+            uint64_t* sortedKeys = arena->allocate<uint64_t>(order.size());
+            for (size_t i = 0; i < order.size(); ++i) {
+                sortedCommands[i] = commands[order[i]];
+                sortedKeys[i] = keys[order[i]];
+            }
+            commands = sortedCommands;
+            keys = sortedKeys;
+            capacity = order.size();
+        }
+
+        void reset() override {
+            lastCount = count;
+            commands = nullptr;
+            keys = nullptr;
+            count = 0;
+            capacity = 0;
+        }
+
+    private:
+        void grow(size_t minimumCapacity) {
+            size_t newCapacity = std::max<size_t>({minimumCapacity, capacity * 2, lastCount, 64});
+            CommandType* newCommands = arena->allocate<CommandType>(newCapacity);
+            uint64_t* newKeys = arena->allocate<uint64_t>(newCapacity);
+            if (count > 0) {
+                std::memcpy(newCommands, commands, count * sizeof(CommandType));
+                std::memcpy(newKeys, keys, count * sizeof(uint64_t));
+            }
+            commands = newCommands;
+            keys = newKeys;
+            capacity = newCapacity;
+        }
+
+        CommandType* commands = nullptr;
     };
 
-} // namspace parteeengine::rendering 
\ No newline at end of file
+} // namspace parteeengine::rendering
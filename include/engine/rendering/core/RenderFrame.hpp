@@ -1,28 +1,148 @@
 #pragma once
 
+#include "engine/rendering/core/Camera2d.hpp"
 #include "engine/rendering/core/RenderCommandBucket.hpp"
+#include "engine/rendering/core/SortKey.hpp"
+#include "engine/core/jobs/JobSystem.hpp"
+#include "engine/util/LinearArena.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <typeindex>
+#include <utility>
+#include <vector>
 
 namespace parteeengine::rendering {
 
+    // Consecutive commands of one bucket in submission order. Renderers call the
+    // bucket's handler once per run.
+    struct RenderRun {
+        uint32_t bucket; // Index into getBuckets()
+        uint32_t begin;  // First command in the bucket, after sorting
+        uint32_t count;
+    };
+
+    // Commands gathered for one frame, bucketed by type, each with a SortKey.
+    // sort() orders all of them by key across buckets and cuts the order into
+    // runs; commands of each bucket are rearranged so every run is contiguous.
+    //
+    // Buckets persist from frame to frame and clear() only resets them. Their
+    // storage comes from a linear arena that keeps its capacity, so a frame no
+    // bigger than the ones before it gathers without touching the heap.
     struct RenderFrame {
-        std::unordered_map<std::type_index, std::unique_ptr<IRenderCommandBucket>> buckets;
+        template<typename CommandType>
+        void emit(const CommandType& command, uint64_t sortKey = 0) { getBucket<CommandType>().emplace(sortKey, command); }
+        // Constructs the command in its bucket from args.
+        template<typename CommandType, typename... Args>
+        CommandType& emplace(uint64_t sortKey, Args&&... args) { return getBucket<CommandType>().emplace(sortKey, std::forward<Args>(args)...); }
 
+        // Created on first use. Gatherers emitting many commands can look it up once and emplace into it directly.
+        template<typename CommandType>
+        RenderCommandBucket<CommandType>& getBucket();
+        // Index of CommandType's bucket in getBuckets(), or -1 if it hasn't been created.
         template<typename CommandType>
-        void emit(CommandType command) {
-            auto typeIndex = std::type_index(typeid(CommandType));
-            auto it = buckets.find(typeIndex);
-            if (it == buckets.end()) {
-                auto bucket = std::make_unique<RenderCommandBucket<CommandType>>();
-                bucket->commands.push_back(command);
-                buckets[typeIndex] = std::move(bucket);
-            } else {
-                auto bucket = static_cast<RenderCommandBucket<CommandType>*>(it->second.get());
-                bucket->commands.push_back(command);
+        int findBucket() const;
+
+        // Gathers count items across the job system. fn(begin, end, bucket) emits the
+        // commands for items [begin, end) into bucket, which belongs to that range
+        // alone; the ranges are concatenated in order afterwards, so the frame ends
+        // up exactly as if fn(0, count, getBucket<CommandType>()) had run serially.
+        template<typename CommandType, typename Function>
+        void gatherParallel(size_t count, size_t minBatchSize, Function&& fn);
+
+        // Set by the render module before gathering; gatherers cull against getView().visible.
+        void setView(const RenderView& newView) { view = newView; }
+        const RenderView& getView() const { return view; }
+
+        // Radix sorts every command by key. Equal keys keep emission order, and
+        // buckets their creation order, so the submission order is deterministic.
+        void sort();
+        // Resets every bucket and the arena for the next frame.
+        void clear();
+
+        const std::vector<std::unique_ptr<IRenderCommandBucket>>& getBuckets() const { return buckets; }
+        // Submission order, valid after sort().
+        const std::vector<RenderRun>& getRuns() const { return runs; }
+
+    private:
+        struct SortEntry {
+            uint64_t key;
+            uint32_t bucket;
+            uint32_t index;
+        };
+
+        RenderView view;
+        LinearArena arena; // Command storage, declared first so it outlives the buckets
+        std::vector<std::unique_ptr<IRenderCommandBucket>> buckets; // In creation order
+        std::unordered_map<std::type_index, size_t> bucketIndices;
+
+        // Each parallel gather range emits into its own frame, as arenas aren't thread safe
+        std::vector<std::unique_ptr<RenderFrame>> partitions;
+        std::vector<size_t> partitionStarts; // Bucket size per partition before the current gather
+
+        std::vector<SortEntry> entries;
+        std::vector<SortEntry> scratch;
+        std::vector<std::vector<uint32_t>> orders; // Sorted command order per bucket
+        std::vector<RenderRun> runs;
+    };
+
+    template<typename CommandType>
+    RenderCommandBucket<CommandType>& RenderFrame::getBucket() {
+        auto typeIndex = std::type_index(typeid(CommandType));
+        auto it = bucketIndices.find(typeIndex);
+        if (it != bucketIndices.end()) {
+            return static_cast<RenderCommandBucket<CommandType>&>(*buckets[it->second]);
+        }
+        auto created = std::make_unique<RenderCommandBucket<CommandType>>(arena);
+        RenderCommandBucket<CommandType>& bucket = *created;
+        bucketIndices.emplace(typeIndex, buckets.size());
+        buckets.push_back(std::move(created));
+        return bucket;
+    }
+
+    template<typename CommandType>
+    int RenderFrame::findBucket() const {
+        auto it = bucketIndices.find(std::type_index(typeid(CommandType)));
+        return it != bucketIndices.end() ? static_cast<int>(it->second) : -1;
+    }
+
+    template<typename CommandType, typename Function>
+    void RenderFrame::gatherParallel(size_t count, size_t minBatchSize, Function&& fn) {
+        RenderCommandBucket<CommandType>& target = getBucket<CommandType>();
+        minBatchSize = std::max<size_t>(minBatchSize, 1);
+        const size_t partitionCount = std::min((count + minBatchSize - 1) / minBatchSize, jobs::JobSystem::getConcurrency());
+        if (partitionCount <= 1) {
+            fn(size_t(0), count, target);
+            return;
+        }
+
+        while (partitions.size() < partitionCount) {
+            partitions.push_back(std::make_unique<RenderFrame>());
+        }
+        // Buckets are created up front; getBucket isn't safe to call concurrently
+        partitionStarts.resize(partitionCount);
+        for (size_t p = 0; p < partitionCount; ++p) {
+            partitionStarts[p] = partitions[p]->getBucket<CommandType>().size();
+        }
+
+        const size_t partitionSize = (count + partitionCount - 1) / partitionCount;
+        jobs::JobSystem::parallelFor(partitionCount, 1, [&](size_t begin, size_t end) {
+            for (size_t p = begin; p < end; ++p) {
+                fn(p * partitionSize, std::min(count, (p + 1) * partitionSize), partitions[p]->getBucket<CommandType>());
             }
+        });
+
+        size_t total = target.size();
+        for (size_t p = 0; p < partitionCount; ++p) {
+            total += partitions[p]->getBucket<CommandType>().size() - partitionStarts[p];
         }
-    };
-}
\ No newline at end of file
+        target.reserve(total);
+        for (size_t p = 0; p < partitionCount; ++p) {
+            RenderCommandBucket<CommandType>& partition = partitions[p]->getBucket<CommandType>();
+            target.append(partition.getCommands().subspan(partitionStarts[p]), partition.getKeys().subspan(partitionStarts[p]));
+        }
+    }
+
+} // namespace parteeengine::rendering
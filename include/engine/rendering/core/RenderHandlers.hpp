@@ -0,0 +1,71 @@
+#pragma once
+
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/rendering/core/RenderCommandBucket.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace parteeengine::rendering {
+
+    template<typename Renderer>
+    struct RenderContext;
+
+    // Pairs a command type with the handler that draws it. Handler is a function
+    // object called as handler(std::span<const CommandType>, const RenderContext<Renderer>&).
+    template<typename CommandType, typename Handler>
+    struct RenderBinding {
+        using Command = CommandType;
+        using Function = Handler;
+    };
+
+    // Marks a RenderModule whose handlers are registered at runtime with registerComponent.
+    struct DynamicHandlers {};
+
+    // Fixed set of command types and their handlers, known at compile time. Each
+    // frame every binding finds its bucket once; each run is then dispatched by
+    // comparing its bucket against those indices and calling the handler
+    // directly, so handlers can be inlined and no std::function or hash lookup
+    // sits in the submission loop. Runs of unbound buckets are skipped.
+    template<typename... Bindings>
+    class RenderHandlers {
+    public:
+        RenderHandlers() = default;
+        explicit RenderHandlers(typename Bindings::Function... functions) : functions(std::move(functions)...) {}
+
+        template<typename Renderer>
+        void dispatch(const RenderFrame& frame, const RenderContext<Renderer>& context) {
+            resolve(frame, std::index_sequence_for<Bindings...>{});
+            for (const RenderRun& run : frame.getRuns()) {
+                call(*frame.getBuckets()[run.bucket], run, context, std::index_sequence_for<Bindings...>{});
+            }
+        }
+
+    private:
+        template<size_t... I>
+        void resolve(const RenderFrame& frame, std::index_sequence<I...>) {
+            ((bucketIndices[I] = frame.template findBucket<typename Bindings::Command>()), ...);
+        }
+
+        template<typename Renderer, size_t... I>
+        void call(const IRenderCommandBucket& bucket, const RenderRun& run, const RenderContext<Renderer>& context, std::index_sequence<I...>) {
+            // At most one binding matches; the rest fall through
+            (void)((bucketIndices[I] == static_cast<int>(run.bucket) && (invoke<I>(bucket, run, context), true)) || ...);
+        }
+
+        template<size_t I, typename Renderer>
+        void invoke(const IRenderCommandBucket& bucket, const RenderRun& run, const RenderContext<Renderer>& context) {
+            using Command = typename std::tuple_element_t<I, std::tuple<Bindings...>>::Command;
+            PARTEE_PROFILE_ZONE(bucket.getName());
+            const auto& typed = static_cast<const RenderCommandBucket<Command>&>(bucket);
+            std::get<I>(functions)(typed.getCommands().subspan(run.begin, run.count), context);
+        }
+
+        std::tuple<typename Bindings::Function...> functions;
+        int bucketIndices[sizeof...(Bindings) > 0 ? sizeof...(Bindings) : 1] = {}; // Per binding, -1 if absent this frame
+    };
+
+} // namespace parteeengine::rendering
@@ -1,14 +1,24 @@
 #pragma once
 
 #include "engine/core/modules/Module.hpp"
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/events/EventBus.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+#include "engine/rendering/core/RenderHandlers.hpp"
+#include "engine/rendering/core/RenderTrace.hpp"
 #include "engine/rendering/windows/IWindow.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/core/metrics/Metrics.hpp"
+#include "engine/util/TypeName.hpp"
 
 #include <unordered_map>
 #include <typeindex>
 #include <memory>
 #include <functional>
-
-namespace parteeengine { class EntityManager; } // namespace parteeengine
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace parteeengine::rendering {
 
@@ -18,60 +28,167 @@ namespace parteeengine::rendering {
     struct RenderCommandBucket;
     struct RenderFrame;
     
+    // Gatherers run one after another; large ones split their entities with RenderFrame::gatherParallel.
     using GatherFunction = std::function<void(RenderFrame&, const EntityManager&)>;
+    // Called once per run of consecutive commands of its type, in sort key order.
     template<typename Renderer, typename CommandType>
-    using RenderFunction = std::function<void(RenderCommandBucket<CommandType>&, const RenderContext<Renderer>&)>;
-
-    template<typename Renderer>
+    using RenderFunction = std::function<void(std::span<const CommandType>, const RenderContext<Renderer>&)>;
+
+    // Gathers the frame's commands from the entities and hands them to Renderer.
+    // With the default DynamicHandlers, handlers are registered per command type at
+    // runtime. Handlers can instead be a RenderHandlers list fixed at compile time;
+    // the module then dispatches runs to them itself, and components are registered
+    // with their gatherer alone.
+    template<typename Renderer, typename Handlers = DynamicHandlers>
     class RenderModule : public Module {
     public:
         RenderModule() : window(IWindow::createPlatformWindow()), renderer() {};
         
-        RenderModule<Renderer>& config(WindowConfig config);
+        RenderModule& config(WindowConfig config);
+        // Replaces the platform window, e.g. with a NullWindow for headless runs. Call before initialize.
+        RenderModule& useWindow(std::unique_ptr<IWindow> newWindow);
+        // For renderer-specific configuration before initialize.
+        Renderer& getRenderer() { return renderer; }
+        // The compile-time handlers, e.g. to configure stateful ones before initialize.
+        Handlers& getHandlers() { return handlers; }
+
+        // Writes the commands gathered by the next frameCount frames (0 for every frame) to a
+        // render trace that tools/parteereplay plays back. Returns false if the file can't be created.
+        bool recordTrace(const std::string& filePath, uint64_t frameCount = 0);
 
         bool initialize(const ModuleInput& input);
         bool update(const ModuleInput& input);
 
         template <typename CommandType>
-        RenderModule<Renderer>& registerComponent(GatherFunction gatherer, RenderFunction<Renderer, CommandType> renderFunc);
-\
+        RenderModule& registerComponent(GatherFunction gatherer, RenderFunction<Renderer, CommandType> renderFunc);
+        // Registers a gatherer without a render handler. Its commands are drawn if Handlers binds
+        // their type, and otherwise only gathered.
+        template <typename CommandType>
+        RenderModule& registerComponent(GatherFunction gatherer);
+        // Registers a command type that another type's gatherer emits, so it is traced and, with
+        // a handler, drawn. Without one it is drawn if Handlers binds it.
+        template <typename CommandType>
+        RenderModule& registerCommand();
+        template <typename CommandType>
+        RenderModule& registerCommand(RenderFunction<Renderer, CommandType> renderFunc);
+
     private:
         std::unique_ptr<IWindow> window;
         Renderer renderer;
 
         std::vector<GatherFunction> gatherers;
+        std::vector<const char*> gathererNames; // Profiling zone name per gatherer, parallel to gatherers
         RenderFrame frame;
+
+        RenderTraceWriter trace; // Knows every registered command type, open only while recording
+        uint64_t traceFrameLimit = 0;
+
+        [[no_unique_address]] Handlers handlers;
     };
 
-    template<typename Renderer>
-    RenderModule<Renderer>& RenderModule<Renderer>::config(WindowConfig config) {
+    template<typename Renderer, typename Handlers>
+    RenderModule<Renderer, Handlers>& RenderModule<Renderer, Handlers>::config(WindowConfig config) {
         window->config(config);
+        return *this;
     }
 
-    template<typename Renderer>
-    bool RenderModule<Renderer>::initialize([[maybe_unused]]const ModuleInput& input) {
-        window->create();
-        renderer.initialize(*window);
-        return true;
+    template<typename Renderer, typename Handlers>
+    RenderModule<Renderer, Handlers>& RenderModule<Renderer, Handlers>::useWindow(std::unique_ptr<IWindow> newWindow) {
+        newWindow->config(window->getConfig());
+        window = std::move(newWindow);
+        return *this;
     }
 
-    template<typename Renderer>
-    bool RenderModule<Renderer>::update(const ModuleInput& input) {
-        frame.buckets.clear();
-        for (auto gatherer : gatherers) {
-            gatherer(frame, input.entityManager);
+    template<typename Renderer, typename Handlers>
+    bool RenderModule<Renderer, Handlers>::recordTrace(const std::string& filePath, uint64_t frameCount) {
+        traceFrameLimit = frameCount;
+        return trace.open(filePath);
+    }
+
+    template<typename Renderer, typename Handlers>
+    bool RenderModule<Renderer, Handlers>::initialize(const ModuleInput& input) {
+        if (input.events) {
+            // Window messages arrive inside pollEvents(); the bus delivers them with the frame's other events
+            window->setEventCallback([events = input.events](const WindowEvent& event) { events->publish(event); });
         }
+        window->create();
+        return renderer.initialize(*window);
+    }
 
-        renderer.render(frame, *window);
-        window->swapBuffers();
+    template<typename Renderer, typename Handlers>
+    bool RenderModule<Renderer, Handlers>::update(const ModuleInput& input) {
+        frame.clear();
+        WindowConfig windowConfig = window->getConfig();
+        const std::vector<Camera2d>& cameras = input.entityManager.getComponentArray<Camera2d>();
+        frame.setView(cameras.empty() ? RenderView::screen(windowConfig.width, windowConfig.height)
+                                      : RenderView::fromCamera(cameras.front(), windowConfig.width, windowConfig.height));
+        for (size_t i = 0; i < gatherers.size(); ++i) {
+            PARTEE_PROFILE_ZONE(gathererNames[i]);
+            gatherers[i](frame, input.entityManager);
+        }
+        for (const auto& bucket : frame.getBuckets()) {
+            metrics::Metrics::setGauge(metrics::names::RenderCommandCount, static_cast<double>(bucket->size()),
+                metrics::Metrics::label("bucket", bucket->getName()));
+        }
+        if (trace.isOpen()) {
+            PARTEE_PROFILE_ZONE("RenderTraceWriter::writeFrame");
+            trace.writeFrame(frame, windowConfig.width, windowConfig.height);
+            if (traceFrameLimit > 0 && trace.getFrameCount() >= traceFrameLimit) {
+                trace.close();
+            }
+        }
+        frame.sort();
+
+        {
+            PARTEE_PROFILE_ZONE("RenderModule::render");
+            if constexpr (std::is_same_v<Handlers, DynamicHandlers>) {
+                renderer.render(frame, *window);
+            } else {
+                auto context = renderer.beginFrame(frame, *window);
+                handlers.dispatch(frame, context);
+                renderer.endFrame(*window);
+            }
+        }
+        {
+            PARTEE_PROFILE_ZONE("IWindow::swapBuffers");
+            window->swapBuffers();
+        }
 
         return window->pollEvents();
     }
 
-    template<typename Renderer>
+    template<typename Renderer, typename Handlers>
     template<typename CommandType>
-    RenderModule<Renderer>& RenderModule<Renderer>::registerComponent(GatherFunction gatherer, RenderFunction<Renderer, CommandType> renderFunc) {
+    RenderModule<Renderer, Handlers>& RenderModule<Renderer, Handlers>::registerComponent(GatherFunction gatherer, RenderFunction<Renderer, CommandType> renderFunc) {
+        static_assert(std::is_same_v<Handlers, DynamicHandlers>, "Handlers are fixed at compile time; register the gatherer alone");
         gatherers.emplace_back(gatherer);
+        gathererNames.push_back(readableTypeName(typeid(CommandType)));
+        trace.registerType<CommandType>();
+        renderer.template registerHandler<CommandType>(renderFunc);
+        return *this;
+    }
+
+    template<typename Renderer, typename Handlers>
+    template<typename CommandType>
+    RenderModule<Renderer, Handlers>& RenderModule<Renderer, Handlers>::registerComponent(GatherFunction gatherer) {
+        gatherers.emplace_back(gatherer);
+        gathererNames.push_back(readableTypeName(typeid(CommandType)));
+        trace.registerType<CommandType>();
+        return *this;
+    }
+
+    template<typename Renderer, typename Handlers>
+    template<typename CommandType>
+    RenderModule<Renderer, Handlers>& RenderModule<Renderer, Handlers>::registerCommand() {
+        trace.registerType<CommandType>();
+        return *this;
+    }
+
+    template<typename Renderer, typename Handlers>
+    template<typename CommandType>
+    RenderModule<Renderer, Handlers>& RenderModule<Renderer, Handlers>::registerCommand(RenderFunction<Renderer, CommandType> renderFunc) {
+        static_assert(std::is_same_v<Handlers, DynamicHandlers>, "Handlers are fixed at compile time; register the command alone");
+        trace.registerType<CommandType>();
         renderer.template registerHandler<CommandType>(renderFunc);
         return *this;
     }
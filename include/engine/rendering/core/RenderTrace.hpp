@@ -0,0 +1,208 @@
+#pragma once
+
+#include "engine/rendering/core/RenderCommandBucket.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace parteeengine::assets {
+    struct Mesh;
+} // namespace parteeengine::assets
+
+namespace parteeengine::particles {
+    struct ParticlePool;
+} // namespace parteeengine::particles
+
+namespace parteeengine::rendering {
+
+    class RenderTraceWriter;
+    class RenderTraceReader;
+    struct StaticQuadBatch;
+
+    // Binary trace layout (host byte order; only readable by a build with the same command layouts):
+    //   header:  "PRTR" magic, uint32 version, uint32 sizeof(RenderView)
+    //   records: uint8 tag followed by
+    //     TypeRecord:  uint16 length, type name bytes, uint32 command size (assigned the next type index)
+    //     MeshRecord:  uint32 vertex, index and submesh counts, float boundsMin[3], boundsMax[3],
+    //                  vertices, indices, submesh count * (uint32 indexOffset, uint32 indexCount)
+    //                  (assigned the next mesh id)
+    //     QuadBatchRecord: uint64 sort key, uint64 version, CullBounds, uint32 quad count,
+    //                  quad count * QuadRenderCommand (assigned the next batch id)
+    //     ParticleRecord: uint32 particle count, then that many floats each of posX, posY,
+    //                  r, g, b and a (assigned the next particle id; ids restart every frame)
+    //     FrameRecord: int32 width, int32 height, RenderView, uint16 bucket count, bucket count *
+    //                  (uint16 type, uint32 count, count * uint64 key, count * command bytes)
+    namespace trace {
+        inline constexpr char Magic[4] = {'P', 'R', 'T', 'R'};
+        inline constexpr uint32_t Version = 3;
+        inline constexpr uint8_t TypeRecord = 1;
+        inline constexpr uint8_t MeshRecord = 2;
+        inline constexpr uint8_t FrameRecord = 3;
+        inline constexpr uint8_t QuadBatchRecord = 4;
+        inline constexpr uint8_t ParticleRecord = 5;
+    } // namespace trace
+
+    // Commands are written as their bytes. Specialize for commands that point at
+    // resources: encode() swaps the pointers for ids the trace can carry, and
+    // decode() swaps them back, returning false if an id is unknown.
+    template<typename CommandType>
+    struct RenderTraceTraits {
+        static void encode(CommandType&, RenderTraceWriter&) {}
+        static bool decode(CommandType&, const RenderTraceReader&) { return true; }
+    };
+
+    // Streams the gathered buckets of frames to a render trace, for replaying
+    // them against a renderer with tools/parteereplay. Buckets of types that
+    // weren't registered are left out.
+    class RenderTraceWriter {
+    public:
+        // Returns false if the file cannot be created.
+        bool open(const std::string& filePath);
+        void close();
+        bool isOpen() const { return file.is_open(); }
+
+        template<typename CommandType>
+        void registerType();
+
+        // Call after gathering and before sorting, so a replay sorts like the engine does.
+        void writeFrame(const RenderFrame& frame, int width, int height);
+        uint64_t getFrameCount() const { return frameCount; }
+
+        // Id of mesh in the trace; the mesh is written the first time it is seen.
+        uint32_t addMesh(const assets::Mesh& mesh);
+        // Id of batch in the trace; the batch is written each time a new version of it is seen.
+        uint32_t addQuadBatch(const StaticQuadBatch& batch);
+        // Id in the current frame of the first count particles of pool, which are written
+        // every time: they change from frame to frame.
+        uint32_t addParticles(const particles::ParticlePool& pool, size_t count);
+
+    private:
+        struct TypeEntry {
+            const char* name;
+            uint32_t commandSize;
+            std::function<void(const IRenderCommandBucket&, RenderTraceWriter&)> encode; // Appends the commands to frameBytes
+            int index = -1; // Assigned when the type record is written
+        };
+
+        struct QuadBatchEntry {
+            uint32_t id;
+            uint64_t version;
+        };
+
+        template<typename T>
+        void append(const T& value) { append(&value, sizeof(T)); }
+        void append(const void* data, size_t size);
+
+        std::ofstream file;
+        std::unordered_map<std::type_index, TypeEntry> types;
+        uint16_t typeCount = 0;
+        std::unordered_map<uint64_t, uint32_t> meshes; // Trace id by Mesh::id
+        uint32_t meshCount = 0;
+        std::unordered_map<const StaticQuadBatch*, QuadBatchEntry> quadBatches; // Keyed by address and checked by version
+        uint32_t quadBatchCount = 0;
+        uint32_t particleCount = 0; // Particle records written for the current frame
+        std::vector<uint8_t> frameBytes; // The frame record is built here, after any records it references
+        uint64_t frameCount = 0;
+    };
+
+    // Reads frames back from a render trace into a RenderFrame. Commands of types
+    // that weren't registered are skipped.
+    class RenderTraceReader {
+    public:
+        RenderTraceReader();
+        ~RenderTraceReader();
+
+        // Returns false if the file is missing or not a trace from a compatible build.
+        bool open(const std::string& filePath);
+        void close();
+        bool isOpen() const { return file.is_open(); }
+
+        template<typename CommandType>
+        void registerType();
+
+        // Clears frame and fills it with the next frame's commands and view. width and
+        // height are the size the frame was rendered at. Returns false at the end of the
+        // trace or on a malformed record, e.g. a count larger than the rest of the file
+        // or a mesh whose indices or submeshes are out of range.
+        bool nextFrame(RenderFrame& frame, int& width, int& height);
+
+        // Mesh read from the trace, or nullptr for an unknown id.
+        const assets::Mesh* getMesh(uint32_t id) const;
+        // Static quad batch read from the trace, or nullptr for an unknown id.
+        const StaticQuadBatch* getQuadBatch(uint32_t id) const;
+        // Particles of the current frame, or nullptr for an unknown id. Valid until the next nextFrame().
+        const particles::ParticlePool* getParticles(uint32_t id) const;
+        // Commands dropped so far because their type isn't registered.
+        uint64_t getSkippedCommandCount() const { return skippedCommands; }
+
+    private:
+        struct TypeEntry {
+            uint32_t commandSize;
+            // Reads count commands from bytes and emplaces them with their keys. Returns false if one doesn't decode.
+            std::function<bool(RenderFrame&, const uint8_t*, const uint64_t*, uint32_t, const RenderTraceReader&)> decode;
+        };
+
+        struct TraceType {
+            const TypeEntry* entry; // nullptr if not registered
+            uint32_t commandSize;
+        };
+
+        bool readMesh();
+        bool readQuadBatch();
+        bool readParticles();
+        // Bytes between the read position and the end of the file; counts read from the trace are capped by it.
+        uint64_t remainingBytes();
+
+        std::ifstream file;
+        std::unordered_map<std::string, TypeEntry> registered; // By type name
+        std::vector<TraceType> traceTypes;                     // By index in the trace
+        std::vector<std::unique_ptr<assets::Mesh>> meshes;     // By id
+        std::vector<std::unique_ptr<StaticQuadBatch>> quadBatches; // By id
+        std::vector<std::unique_ptr<particles::ParticlePool>> particlePools; // By id, current frame only
+        std::vector<uint64_t> keys;
+        std::vector<uint8_t> commandBytes;
+        uint64_t skippedCommands = 0;
+        uint64_t fileSize = 0;
+    };
+
+    template<typename CommandType>
+    void RenderTraceWriter::registerType() {
+        TypeEntry entry{typeid(CommandType).name(), static_cast<uint32_t>(sizeof(CommandType)), {}};
+        entry.encode = [](const IRenderCommandBucket& bucket, RenderTraceWriter& writer) {
+            for (CommandType command : static_cast<const RenderCommandBucket<CommandType>&>(bucket).getCommands()) {
+                RenderTraceTraits<CommandType>::encode(command, writer);
+                writer.append(command);
+            }
+        };
+        types.insert_or_assign(std::type_index(typeid(CommandType)), std::move(entry));
+    }
+
+    template<typename CommandType>
+    void RenderTraceReader::registerType() {
+        TypeEntry entry{static_cast<uint32_t>(sizeof(CommandType)), {}};
+        entry.decode = [](RenderFrame& frame, const uint8_t* bytes, const uint64_t* sortKeys, uint32_t count, const RenderTraceReader& reader) {
+            RenderCommandBucket<CommandType>& bucket = frame.getBucket<CommandType>();
+            bucket.reserve(bucket.size() + count);
+            for (uint32_t i = 0; i < count; ++i) {
+                CommandType command;
+                std::memcpy(&command, bytes + size_t(i) * sizeof(CommandType), sizeof(CommandType));
+                if (!RenderTraceTraits<CommandType>::decode(command, reader)) {
+                    return false;
+                }
+                bucket.emplace(sortKeys[i], command);
+            }
+            return true;
+        };
+        registered.insert_or_assign(typeid(CommandType).name(), std::move(entry));
+    }
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace parteeengine::rendering {
+
+    // 64-bit draw order key. The frame submits commands in ascending key order, so
+    // higher fields decide first. Opaque commands group by state, MSB first:
+    //
+    //   layer (8) | translucent (1) | shader (11) | texture (20) | depth (24)
+    //
+    // Translucent commands have to blend back to front, so their depth moves
+    // ahead of the state fields and is inverted, farthest first:
+    //
+    //   layer (8) | translucent (1) | inverted depth (24) | shader (11) | texture (20)
+    struct SortKey {
+        static constexpr int LayerBits = 8;
+        static constexpr int ShaderBits = 11;
+        static constexpr int TextureBits = 20;
+        static constexpr int DepthBits = 24;
+
+        static constexpr uint64_t ShaderMask = (1ull << ShaderBits) - 1;
+        static constexpr uint64_t TextureMask = (1ull << TextureBits) - 1;
+        static constexpr uint64_t DepthMask = (1ull << DepthBits) - 1;
+
+        // Shader field of the built-in renderables
+        static constexpr uint32_t QuadShader = 1;
+        static constexpr uint32_t MeshShader = 2;
+        static constexpr uint32_t ParticleShader = 3;
+
+        // depth is clamped to [0, 1], 0 nearest. shader and texture keep their low bits;
+        // they only group commands, so a collision costs a state change, not correctness.
+        static constexpr uint64_t make(uint8_t layer, bool translucent, uint32_t shader, uint32_t texture, float depth = 0.f) {
+            uint64_t quantized = static_cast<uint64_t>(std::clamp(depth, 0.f, 1.f) * static_cast<float>(DepthMask));
+            uint64_t key = uint64_t(layer) << 56;
+            if (translucent) {
+                return key | (1ull << 55)
+                    | ((DepthMask - quantized) << (ShaderBits + TextureBits))
+                    | ((shader & ShaderMask) << TextureBits)
+                    | (texture & TextureMask);
+            }
+            return key
+                | ((shader & ShaderMask) << (TextureBits + DepthBits))
+                | ((texture & TextureMask) << DepthBits)
+                | quantized;
+        }
+
+        static constexpr uint8_t getLayer(uint64_t key) { return static_cast<uint8_t>(key >> 56); }
+        static constexpr bool isTranslucent(uint64_t key) { return (key >> 55) & 1; }
+    };
+
+} // namespace parteeengine::rendering
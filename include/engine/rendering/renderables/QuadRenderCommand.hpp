@@ -0,0 +1,27 @@
+#pragma once
+
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/util/Color.hpp"
+
+#include <cstdint>
+
+namespace parteeengine::rendering {
+
+    // Normalized rectangle of a texture, with (u0, v0) at the quad's -x, -y corner.
+    // v runs down the texture's rows.
+    struct UvRect {
+        float u0 = 0.f;
+        float v0 = 0.f;
+        float u1 = 1.f;
+        float v1 = 1.f;
+    };
+
+    // Unit quad centered on the transform's position, scaled then rotated.
+    struct QuadRenderCommand {
+        Transform2d transform;
+        Color color;
+        uint32_t texture = 0; // TextureRegistry id, 0 for untextured
+        UvRect uv;            // Part of the texture the quad shows
+    };
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "engine/assets/AssetManager.hpp"
+#include "engine/assets/Mesh.hpp"
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/entities/Component.hpp"
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/rendering/core/Culling.hpp"
+#include "engine/rendering/core/RenderModule.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+#include "engine/rendering/core/RenderTrace.hpp"
+#include "engine/rendering/core/SortKey.hpp"
+#include "engine/rendering/renderers/SoftwareRenderer.hpp"
+#include "engine/util/Color.hpp"
+#if defined(PARTEE_GL_CORE)
+#include "engine/rendering/renderers/GLCoreRenderer.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+
+namespace parteeengine::rendering {
+
+    // Mesh placed by a 2D transform: scaled and rotated in x/y, z left as modeled.
+    struct MeshRenderCommand {
+        const assets::Mesh* mesh;
+        Transform2d transform;
+        Color color;
+        uint32_t texture = 0; // TextureRegistry id, 0 for untextured
+    };
+
+    // The mesh pointer travels through a render trace as the trace's id for the mesh.
+    template<>
+    struct RenderTraceTraits<MeshRenderCommand> {
+        static void encode(MeshRenderCommand& command, RenderTraceWriter& writer) {
+            command.mesh = reinterpret_cast<const assets::Mesh*>(uintptr_t(writer.addMesh(*command.mesh)));
+        }
+        static bool decode(MeshRenderCommand& command, const RenderTraceReader& reader) {
+            command.mesh = reader.getMesh(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(command.mesh)));
+            return command.mesh != nullptr;
+        }
+    };
+
+    struct RenderMeshComponent : public ComponentCRTP<RenderMeshComponent> {
+        assets::AssetHandle<assets::Mesh> mesh;
+        parteeengine::Color color;
+        uint32_t texture = 0; // TextureRegistry id, 0 for untextured
+        uint8_t layer = 0; // Higher layers draw on top
+
+        RenderMeshComponent() = default;
+        RenderMeshComponent(assets::AssetHandle<assets::Mesh> mesh, parteeengine::Color color = {}) : mesh(std::move(mesh)), color(color) {}
+
+        // Meshes still loading are skipped until they are ready, and meshes outside the
+        // frame's view are culled by their bounds.
+        static GatherFunction gatherer() {
+            return std::function<void(RenderFrame&, const parteeengine::EntityManager&)>([](RenderFrame& frame, const parteeengine::EntityManager& entityManager) {
+                auto entities = entityManager.getEntityComponentPairs<RenderMeshComponent>();
+                const CullBounds visibleBounds = frame.getView().visible;
+                frame.gatherParallel<MeshRenderCommand>(entities.size(), 1024, [&](size_t begin, size_t end, RenderCommandBucket<MeshRenderCommand>& bucket) {
+                    constexpr size_t BlockSize = 256;
+                    const assets::Mesh* meshes[BlockSize];
+                    const Transform2d* transforms[BlockSize];
+                    const RenderMeshComponent* components[BlockSize];
+                    float x[BlockSize], y[BlockSize], halfX[BlockSize], halfY[BlockSize];
+                    uint32_t visible[BlockSize];
+                    for (size_t i = begin; i < end;) {
+                        size_t blockSize = 0;
+                        for (; i < end && blockSize < BlockSize; ++i) {
+                            const RenderMeshComponent& component = entities[i].second;
+                            const assets::Mesh* mesh = component.mesh.get();
+                            if (!mesh) {
+                                continue;
+                            }
+                            const Transform2d& transform = entityManager.getComponent<TransformComponent2d>(entities[i].first)->transform;
+                            meshes[blockSize] = mesh;
+                            transforms[blockSize] = &transform;
+                            components[blockSize] = &component;
+                            // Box around the model-space bounds, centered on the origin the transform places
+                            x[blockSize] = transform.position.x;
+                            y[blockSize] = transform.position.y;
+                            halfX[blockSize] = std::max(std::abs(mesh->boundsMin[0]), std::abs(mesh->boundsMax[0])) * transform.scale.x;
+                            halfY[blockSize] = std::max(std::abs(mesh->boundsMin[1]), std::abs(mesh->boundsMax[1])) * transform.scale.y;
+                            ++blockSize;
+                        }
+                        const size_t visibleCount = cullBoxes(visibleBounds, x, y, halfX, halfY, blockSize, visible);
+                        for (size_t v = 0; v < visibleCount; ++v) {
+                            const RenderMeshComponent& component = *components[visible[v]];
+                            bucket.emplace(SortKey::make(component.layer, component.color.a < 1.f, SortKey::MeshShader, batchId(component.mesh.getPath(), component.texture)),
+                                meshes[visible[v]], *transforms[visible[v]], component.color, component.texture);
+                        }
+                    }
+                });
+            });
+        }
+
+        // Texture field of the sort key: the texture and the mesh's path together, so copies
+        // of a mesh end up next to each other and can be drawn instanced. Hashing the path
+        // rather than the address keeps the order the same from run to run.
+        static uint32_t batchId(std::string_view meshPath, uint32_t texture) {
+            uint32_t hash = 2166136261u;
+            for (char c : meshPath) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+            }
+            return hash ^ (texture * 0x9E3779B1u);
+        }
+
+        struct SoftwareHandler {
+            void operator()(std::span<const MeshRenderCommand> commands, const RenderContext<SoftwareRenderer>& context) const {
+                for (const MeshRenderCommand& command : commands) {
+                    context.renderer->drawMesh(*command.mesh, command.transform, command.color);
+                }
+            }
+        };
+        static RenderFunction<SoftwareRenderer, MeshRenderCommand> softwareHandler() { return SoftwareHandler{}; }
+
+#if defined(PARTEE_GL_CORE)
+        // Draws each run of commands sharing a mesh and texture as one instanced call per submesh.
+        struct GLCoreHandler {
+            void operator()(std::span<const MeshRenderCommand> commands, const RenderContext<GLCoreRenderer>& context) const {
+                GLCoreRenderer::InstanceRange instances = context.renderer->allocateInstances(commands.size());
+                if (!instances.data) {
+                    return;
+                }
+                gl::writeInstances(commands, instances.data);
+
+                size_t first = 0;
+                for (size_t i = 1; i <= commands.size(); ++i) {
+                    if (i == commands.size() || commands[i].mesh != commands[first].mesh || commands[i].texture != commands[first].texture) {
+                        context.renderer->drawMesh(*commands[first].mesh, instances, first, i - first, commands[first].texture);
+                        first = i;
+                    }
+                }
+            }
+        };
+        static RenderFunction<GLCoreRenderer, MeshRenderCommand> glCoreHandler() { return GLCoreHandler{}; }
+#endif
+    };
+
+} // namespace parteeengine::rendering
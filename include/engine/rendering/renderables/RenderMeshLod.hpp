@@ -0,0 +1,119 @@
+#pragma once
+
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/entities/Component.hpp"
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/rendering/core/Culling.hpp"
+#include "engine/rendering/core/MeshLod.hpp"
+#include "engine/rendering/core/RenderModule.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+#include "engine/rendering/core/SortKey.hpp"
+#include "engine/rendering/renderables/RenderMesh.hpp"
+#include "engine/util/Color.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // Mesh drawn at the level of its LOD chain that suits its size on screen. Emits
+    // MeshRenderCommands, so it draws with the RenderMeshComponent handlers.
+    struct RenderMeshLodComponent : public ComponentCRTP<RenderMeshLodComponent> {
+        std::shared_ptr<const MeshLodChain> chain;
+        parteeengine::Color color;
+        uint32_t texture = 0; // TextureRegistry id, 0 for untextured
+        uint8_t layer = 0; // Higher layers draw on top
+
+        RenderMeshLodComponent() = default;
+        RenderMeshLodComponent(std::shared_ptr<const MeshLodChain> chain, parteeengine::Color color = {}) : chain(std::move(chain)), color(color) {}
+
+        // Levels are picked a block at a time, with one selectLods call per run of instances
+        // sharing a chain, before the block is culled. Instances whose levels are all still
+        // loading are skipped. The level each entity drew last frame, which the hysteresis
+        // starts from, is kept by the gatherer, so gathering leaves the components untouched.
+        static GatherFunction gatherer() {
+            auto drawnLevels = std::make_shared<std::vector<uint8_t>>(); // By entity id, shared by copies
+            return std::function<void(RenderFrame&, const parteeengine::EntityManager&)>([drawnLevels](RenderFrame& frame, const parteeengine::EntityManager& entityManager) {
+                auto entities = entityManager.getEntityComponentPairs<RenderMeshLodComponent>();
+                // Sized up front; each entity then only touches its own byte, so the gather threads don't race
+                EntityId maxId = 0;
+                for (const auto& [entity, component] : entities) {
+                    maxId = std::max(maxId, entity.id);
+                }
+                if (drawnLevels->size() <= maxId) {
+                    drawnLevels->resize(size_t(maxId) + 1, 0);
+                }
+                uint8_t* lods = drawnLevels->data();
+                const CullBounds visibleBounds = frame.getView().visible;
+                const float pixelsPerUnit = frame.getView().getPixelsPerUnit();
+                frame.gatherParallel<MeshRenderCommand>(entities.size(), 1024, [&](size_t begin, size_t end, RenderCommandBucket<MeshRenderCommand>& bucket) {
+                    constexpr size_t BlockSize = 256;
+                    const assets::Mesh* meshes[BlockSize];
+                    const Transform2d* transforms[BlockSize];
+                    const RenderMeshLodComponent* components[BlockSize];
+                    EntityId ids[BlockSize];
+                    float x[BlockSize], y[BlockSize], halfX[BlockSize], halfY[BlockSize], levels[BlockSize];
+                    uint32_t visible[BlockSize];
+                    for (size_t i = begin; i < end;) {
+                        size_t blockSize = 0;
+                        for (; i < end && blockSize < BlockSize; ++i) {
+                            const RenderMeshLodComponent& component = entities[i].second;
+                            if (!component.chain) {
+                                continue;
+                            }
+                            uint8_t drawn = 0;
+                            const EntityId id = entities[i].first.id;
+                            const assets::Mesh* mesh = component.chain->resolve(lods[id], drawn);
+                            if (!mesh) {
+                                continue;
+                            }
+                            const Transform2d& transform = entityManager.getComponent<TransformComponent2d>(entities[i].first)->transform;
+                            transforms[blockSize] = &transform;
+                            components[blockSize] = &component;
+                            ids[blockSize] = id;
+                            x[blockSize] = transform.position.x;
+                            y[blockSize] = transform.position.y;
+                            setHalfExtents(*mesh, transform, halfX[blockSize], halfY[blockSize]);
+                            levels[blockSize] = static_cast<float>(drawn);
+                            ++blockSize;
+                        }
+
+                        for (size_t first = 0, last = 1; first < blockSize; first = last++) {
+                            while (last < blockSize && components[last]->chain == components[first]->chain) {
+                                ++last;
+                            }
+                            selectLods(*components[first]->chain, pixelsPerUnit, halfX + first, halfY + first, levels + first, last - first);
+                        }
+                        // Levels share a model's shape but may not share its bounds exactly
+                        for (size_t b = 0; b < blockSize; ++b) {
+                            const RenderMeshLodComponent& component = *components[b];
+                            meshes[b] = component.chain->resolve(static_cast<uint8_t>(levels[b]), lods[ids[b]]);
+                            setHalfExtents(*meshes[b], *transforms[b], halfX[b], halfY[b]);
+                        }
+
+                        const size_t visibleCount = cullBoxes(visibleBounds, x, y, halfX, halfY, blockSize, visible);
+                        for (size_t v = 0; v < visibleCount; ++v) {
+                            const RenderMeshLodComponent& component = *components[visible[v]];
+                            const assets::Mesh* mesh = meshes[visible[v]];
+                            const uint8_t lod = lods[ids[visible[v]]];
+                            const uint32_t batch = RenderMeshComponent::batchId(component.chain->levels[lod].getPath(), component.texture);
+                            bucket.emplace(SortKey::make(component.layer, component.color.a < 1.f, SortKey::MeshShader, batch),
+                                mesh, *transforms[visible[v]], component.color, component.texture);
+                        }
+                    }
+                });
+            });
+        }
+
+        // Box around the model-space bounds, centered on the origin the transform places.
+        static void setHalfExtents(const assets::Mesh& mesh, const Transform2d& transform, float& halfX, float& halfY) {
+            halfX = std::max(std::abs(mesh.boundsMin[0]), std::abs(mesh.boundsMax[0])) * transform.scale.x;
+            halfY = std::max(std::abs(mesh.boundsMin[1]), std::abs(mesh.boundsMax[1])) * transform.scale.y;
+        }
+    };
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/particles/ParticleEmitter.hpp"
+#include "engine/rendering/core/Culling.hpp"
+#include "engine/rendering/core/RenderModule.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+#include "engine/rendering/core/RenderTrace.hpp"
+#include "engine/rendering/core/SortKey.hpp"
+#include "engine/rendering/renderables/QuadRenderCommand.hpp"
+#include "engine/rendering/renderers/SoftwareRenderer.hpp"
+#include "engine/util/Simd.hpp"
+#if defined(_WIN32)
+#include "engine/rendering/renderers/OpenGLRenderer.hpp"
+#endif
+#if defined(PARTEE_GL_CORE)
+#include "engine/rendering/batching/QuadBatchBuilder.hpp"
+#include "engine/rendering/renderers/GLCoreRenderer.hpp"
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // One command per emitter. Points straight into the emitter's pool, which is
+    // never reallocated, so no particle data is copied during gathering.
+    struct ParticleBatchRenderCommand {
+        const particles::ParticlePool* pool;
+        size_t count;
+        float size;
+    };
+
+    // The particles are copied into the trace every frame, as they change every frame.
+    template<>
+    struct RenderTraceTraits<ParticleBatchRenderCommand> {
+        static void encode(ParticleBatchRenderCommand& command, RenderTraceWriter& writer) {
+            command.pool = reinterpret_cast<const particles::ParticlePool*>(uintptr_t(writer.addParticles(*command.pool, command.count)));
+        }
+        static bool decode(ParticleBatchRenderCommand& command, const RenderTraceReader& reader) {
+            command.pool = reader.getParticles(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(command.pool)));
+            return command.pool != nullptr && command.count <= command.pool->count;
+        }
+    };
+
+    struct RenderParticles {
+        // Emitters whose particles all lie outside the frame's view are culled as a whole.
+        static GatherFunction gatherer() {
+            return std::function<void(RenderFrame&, const parteeengine::EntityManager&)>([](RenderFrame& frame, const parteeengine::EntityManager& entityManager) {
+                const CullBounds visibleBounds = frame.getView().visible;
+                for (auto& [entity, emitter] : entityManager.getEntityComponentPairs<particles::ParticleEmitter>()) {
+                    if (!emitter.pool || emitter.pool->count == 0) {
+                        continue;
+                    }
+                    if (!overlaps(bounds(*emitter.pool, emitter.pool->count, 0.5f * emitter.size), visibleBounds)) {
+                        continue;
+                    }
+                    frame.emit(ParticleBatchRenderCommand{
+                        .pool = emitter.pool.get(),
+                        .count = emitter.pool->count,
+                        .size = emitter.size
+                    }, SortKey::make(0, true, SortKey::ParticleShader, 0));
+                }
+            });
+        }
+
+        // Box around the first count particles of pool, grown by half on every side.
+        static CullBounds bounds(const particles::ParticlePool& pool, size_t count, float half) {
+            simd::Float4 minX = simd::set1(std::numeric_limits<float>::max()), minY = minX;
+            simd::Float4 maxX = simd::set1(std::numeric_limits<float>::lowest()), maxY = maxX;
+            size_t i = 0;
+            for (; i + simd::Width <= count; i += simd::Width) {
+                const simd::Float4 x = simd::load(&pool.posX[i]);
+                const simd::Float4 y = simd::load(&pool.posY[i]);
+                minX = simd::min(minX, x);
+                minY = simd::min(minY, y);
+                maxX = simd::max(maxX, x);
+                maxY = simd::max(maxY, y);
+            }
+            alignas(16) float lanes[4][simd::Width];
+            simd::store(lanes[0], minX);
+            simd::store(lanes[1], minY);
+            simd::store(lanes[2], maxX);
+            simd::store(lanes[3], maxY);
+            CullBounds result{lanes[0][0], lanes[1][0], lanes[2][0], lanes[3][0]};
+            for (int lane = 1; lane < simd::Width; ++lane) {
+                result.minX = std::min(result.minX, lanes[0][lane]);
+                result.minY = std::min(result.minY, lanes[1][lane]);
+                result.maxX = std::max(result.maxX, lanes[2][lane]);
+                result.maxY = std::max(result.maxY, lanes[3][lane]);
+            }
+            for (; i < count; ++i) {
+                result.minX = std::min(result.minX, pool.posX[i]);
+                result.minY = std::min(result.minY, pool.posY[i]);
+                result.maxX = std::max(result.maxX, pool.posX[i]);
+                result.maxY = std::max(result.maxY, pool.posY[i]);
+            }
+            return CullBounds{result.minX - half, result.minY - half, result.maxX + half, result.maxY + half};
+        }
+
+        // Turns the particles into unrotated quads and queues them like any other quads.
+        struct SoftwareHandler {
+            std::shared_ptr<std::vector<QuadRenderCommand>> quads = std::make_shared<std::vector<QuadRenderCommand>>(); // Reused between frames, shared by copies
+
+            void operator()(std::span<const ParticleBatchRenderCommand> commands, const RenderContext<SoftwareRenderer>& context) const {
+                for (const ParticleBatchRenderCommand& command : commands) {
+                    const particles::ParticlePool& pool = *command.pool;
+                    quads->resize(command.count);
+                    for (size_t i = 0; i < command.count; ++i) {
+                        (*quads)[i] = QuadRenderCommand{
+                            Transform2d{{pool.posX[i], pool.posY[i]}, 0.f, {command.size, command.size}},
+                            Color{pool.r[i], pool.g[i], pool.b[i], pool.a[i]}, 0, {}};
+                    }
+                    context.renderer->drawQuads(std::span<const QuadRenderCommand>(*quads));
+                }
+            }
+        };
+        static RenderFunction<SoftwareRenderer, ParticleBatchRenderCommand> softwareHandler() { return SoftwareHandler{}; }
+
+#if defined(_WIN32)
+        // Vertices are expanded on the CPU so a whole emitter is a single glBegin/glEnd.
+        struct OpenGLHandler {
+            void operator()(std::span<const ParticleBatchRenderCommand> commands, [[maybe_unused]] const RenderContext<OpenGLRenderer>& context) const {
+                for (const ParticleBatchRenderCommand& command : commands) {
+                    const particles::ParticlePool& pool = *command.pool;
+                    const float half = command.size * 0.5f;
+
+                    glBegin(GL_QUADS);
+                    for (size_t i = 0; i < command.count; ++i) {
+                        glColor4f(pool.r[i], pool.g[i], pool.b[i], pool.a[i]);
+                        glVertex2f(pool.posX[i] - half, pool.posY[i] - half);
+                        glVertex2f(pool.posX[i] + half, pool.posY[i] - half);
+                        glVertex2f(pool.posX[i] + half, pool.posY[i] + half);
+                        glVertex2f(pool.posX[i] - half, pool.posY[i] + half);
+                    }
+                    glEnd();
+                }
+            }
+        };
+        static RenderFunction<OpenGLRenderer, ParticleBatchRenderCommand> openGLHandler() { return OpenGLHandler{}; }
+#endif
+
+#if defined(PARTEE_GL_CORE)
+        // Streams one unrotated quad instance per particle straight from the pool, one instanced call per emitter.
+        struct GLCoreHandler {
+            void operator()(std::span<const ParticleBatchRenderCommand> commands, const RenderContext<GLCoreRenderer>& context) const {
+                for (const ParticleBatchRenderCommand& command : commands) {
+                    const particles::ParticlePool& pool = *command.pool;
+                    GLCoreRenderer::InstanceRange instances = context.renderer->allocateInstances(command.count);
+                    if (!instances.data) {
+                        return;
+                    }
+                    for (size_t i = 0; i < command.count; ++i) {
+                        instances.data[i] = gl::InstanceData{
+                            {command.size, 0.f, 0.f, command.size},
+                            {pool.posX[i], pool.posY[i]},
+                            QuadBatchBuilder::packColor(Color{pool.r[i], pool.g[i], pool.b[i], pool.a[i]}),
+                            {0, 0, 65535, 65535}
+                        };
+                    }
+                    context.renderer->drawQuads(instances, 0, command.count, 0);
+                }
+            }
+        };
+        static RenderFunction<GLCoreRenderer, ParticleBatchRenderCommand> glCoreHandler() { return GLCoreHandler{}; }
+#endif
+    };
+
+} // namespace parteeengine::rendering
@@ -2,60 +2,199 @@
 
 #include "engine/core/entities/EntityManager.hpp"
 #include "engine/core/entities/Component.hpp"
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/rendering/core/Culling.hpp"
+#include "engine/rendering/core/RenderModule.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+#include "engine/rendering/core/SortKey.hpp"
+#include "engine/rendering/renderables/QuadRenderCommand.hpp"
+#include "engine/rendering/batching/QuadBatchBuilder.hpp"
+#include "engine/rendering/batching/StaticQuadCache.hpp"
+#include "engine/rendering/renderers/SoftwareRenderer.hpp"
 #include "engine/util/Color.hpp"
+#if defined(_WIN32)
+#include "engine/rendering/renderers/OpenGLRenderer.hpp"
+#include "engine/rendering/renderers/OpenGLRenderContext.hpp"
+#endif
+#if defined(PARTEE_GL_CORE)
+#include "engine/core/jobs/JobSystem.hpp"
+#include "engine/rendering/renderers/GLCoreRenderer.hpp"
+#endif
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <span>
+#include <vector>
 
 namespace parteeengine::rendering {
 
-    struct QuadRenderCommand {
-        Transform2d transform;
-        Color color;
-    };
-
     struct RenderQuadComponent : public ComponentCRTP<RenderQuadComponent> {
         parteeengine::Color color;
+        uint8_t layer = 0; // Higher layers draw on top
+
+        // Static quads are drawn from retained batches instead of being gathered each frame. Changing
+        // one, its transform or this flag rebuilds the batches it leaves and joins on the next frame.
+        bool isStatic = false;
 
         RenderQuadComponent() = default;
         RenderQuadComponent(parteeengine::Color color) : color(color) {}
 
+        static uint64_t sortKey(const RenderQuadComponent& quad) {
+            return SortKey::make(quad.layer, quad.color.a < 1.f, SortKey::QuadShader, 0);
+        }
+
+        // Dynamic quads outside the frame's view are culled before they become commands;
+        // static ones are culled a batch at a time and emitted as StaticQuadBatchCommands.
         static GatherFunction gatherer() {
-            return std::function<void(RenderFrame&, const parteeengine::EntityManager&)>([](RenderFrame& frame, const parteeengine::EntityManager& entityManager) {
-                auto entities = entityManager.getEntityComponentPairs<RenderQuadComponent>();
-                for (auto& [entity, quad] : entities) {
-                    auto transform = entityManager.getComponent<TransformComponent2d>(entity);
+            auto cache = std::make_shared<StaticQuadCache>();
+            return std::function<void(RenderFrame&, const parteeengine::EntityManager&)>([cache](RenderFrame& frame, const parteeengine::EntityManager& entityManager) {
+                cache->update(entityManager);
+                const std::vector<StaticQuadCache::DynamicQuad>& quads = cache->getDynamicQuads();
+                const CullBounds visibleBounds = frame.getView().visible;
+                frame.gatherParallel<QuadRenderCommand>(quads.size(), 4096, [&](size_t begin, size_t end, RenderCommandBucket<QuadRenderCommand>& bucket) {
+                    // Bounds are culled a block at a time, four quads per SIMD test
+                    constexpr size_t BlockSize = 256;
+                    float x[BlockSize], y[BlockSize], halfX[BlockSize], halfY[BlockSize];
+                    uint32_t visible[BlockSize];
+                    for (size_t blockBegin = begin; blockBegin < end; blockBegin += BlockSize) {
+                        const size_t blockSize = std::min(BlockSize, end - blockBegin);
+                        for (size_t i = 0; i < blockSize; ++i) {
+                            const Transform2d& transform = *quads[blockBegin + i].transform;
+                            x[i] = transform.position.x;
+                            y[i] = transform.position.y;
+                            halfX[i] = 0.5f * transform.scale.x;
+                            halfY[i] = 0.5f * transform.scale.y;
+                        }
+                        const size_t visibleCount = cullBoxes(visibleBounds, x, y, halfX, halfY, blockSize, visible);
+                        for (size_t v = 0; v < visibleCount; ++v) {
+                            const StaticQuadCache::DynamicQuad& quad = quads[blockBegin + visible[v]];
+                            bucket.emplace(sortKey(*quad.component), *quad.transform, quad.component->color);
+                        }
+                    }
+                });
 
-                    frame.emit(QuadRenderCommand{
-                        .transform = transform->transform,
-                        .color = quad.color
-                    });
+                if (!cache->getBatches().empty()) {
+                    RenderCommandBucket<StaticQuadBatchCommand>& batches = frame.getBucket<StaticQuadBatchCommand>();
+                    for (const StaticQuadBatch& batch : cache->getBatches()) {
+                        if (overlaps(batch.bounds, visibleBounds)) {
+                            batches.emplace(batch.sortKey, &batch);
+                        }
+                    }
                 }
             });
         }
 
-        static RenderFunction<OpenGLRenderer, QuadRenderCommand> openGLHandler() {
-            return std::function<void(const RenderCommandBucket<QuadRenderCommand>&, const RenderContext<OpenGLRenderer>&)>([](const RenderCommandBucket<QuadRenderCommand>& bucket, [[maybe_unused]]const RenderContext<OpenGLRenderer>& context) {
-                for (const auto& command : bucket.commands) {
-                    // Set up OpenGL state for rendering the quad
-                    glPushMatrix();
-                    glTranslatef(command.transform.position.x, command.transform.position.y, 0.f);
-                    glRotatef(command.transform.rotation, 0.f, 0.f, 1.f);
-                    glScalef(command.transform.scale.x, command.transform.scale.y, 1.f);
+        // Queues every quad as two triangles; the software renderer bins and blends them in order.
+        struct SoftwareHandler {
+            void operator()(std::span<const QuadRenderCommand> commands, const RenderContext<SoftwareRenderer>& context) const {
+                context.renderer->drawQuads(commands);
+            }
+        };
+        static RenderFunction<SoftwareRenderer, QuadRenderCommand> softwareHandler() { return SoftwareHandler{}; }
 
-                    glColor4f(command.color.r, command.color.g, command.color.b, command.color.a);
+        struct StaticBatchSoftwareHandler {
+            void operator()(std::span<const StaticQuadBatchCommand> commands, const RenderContext<SoftwareRenderer>& context) const {
+                for (const StaticQuadBatchCommand& command : commands) {
+                    context.renderer->drawQuads(std::span<const QuadRenderCommand>(command.batch->quads));
+                }
+            }
+        };
+        static RenderFunction<SoftwareRenderer, StaticQuadBatchCommand> staticBatchSoftwareHandler() { return StaticBatchSoftwareHandler{}; }
 
-                    // Render a unit quad centered at the origin
-                    glBegin(GL_QUADS);
-                    glVertex2f(-0.5f, -0.5f);
-                    glVertex2f(0.5f, -0.5f);
-                    glVertex2f(0.5f, 0.5f);
-                    glVertex2f(-0.5f, 0.5f);
-                    glEnd();
+#if defined(_WIN32)
+        // Draws every quad of the frame from one client-side vertex array, one
+        // glDrawElements per batch instead of a matrix push and glBegin per quad.
+        struct OpenGLHandler {
+            std::shared_ptr<QuadBatchBuilder> builder = std::make_shared<QuadBatchBuilder>(); // Keeps its buffers between frames, shared by copies
 
-                    glPopMatrix();
+            void operator()(std::span<const QuadRenderCommand> commands, const RenderContext<OpenGLRenderer>& context) const {
+                builder->build(commands);
+                if (builder->getBatches().empty()) {
+                    return;
                 }
-            });
-        }
+
+                glEnableClientState(GL_VERTEX_ARRAY);
+                glEnableClientState(GL_COLOR_ARRAY);
+                uint32_t boundTexture = 0;
+                for (const QuadBatch& batch : builder->getBatches()) {
+                    if (batch.texture != boundTexture) {
+                        if (batch.texture != 0) {
+                            glEnable(GL_TEXTURE_2D);
+                            glBindTexture(GL_TEXTURE_2D, context.renderer->getTexture(batch.texture));
+                            glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+                        } else {
+                            glDisable(GL_TEXTURE_2D);
+                            glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+                        }
+                        boundTexture = batch.texture;
+                    }
+
+                    // Point the arrays at the batch's first vertex so the shared 16-bit index pattern applies
+                    const QuadVertex* first = builder->getVertices().data() + size_t(batch.firstQuad) * 4;
+                    glVertexPointer(2, GL_FLOAT, sizeof(QuadVertex), &first->x);
+                    glTexCoordPointer(2, GL_FLOAT, sizeof(QuadVertex), &first->u);
+                    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(QuadVertex), &first->color);
+                    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(batch.quadCount * 6), GL_UNSIGNED_SHORT, builder->getIndices().data());
+                }
+                if (boundTexture != 0) {
+                    glDisable(GL_TEXTURE_2D);
+                    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+                }
+                glDisableClientState(GL_COLOR_ARRAY);
+                glDisableClientState(GL_VERTEX_ARRAY);
+            }
+        };
+        static RenderFunction<OpenGLRenderer, QuadRenderCommand> openGLHandler() { return OpenGLHandler{}; }
+
+        // Client-side arrays live in system memory anyway, so batches are rebuilt like any other quads.
+        struct StaticBatchOpenGLHandler {
+            OpenGLHandler quads;
+
+            void operator()(std::span<const StaticQuadBatchCommand> commands, const RenderContext<OpenGLRenderer>& context) const {
+                for (const StaticQuadBatchCommand& command : commands) {
+                    quads(std::span<const QuadRenderCommand>(command.batch->quads), context);
+                }
+            }
+        };
+        static RenderFunction<OpenGLRenderer, StaticQuadBatchCommand> staticBatchOpenGLHandler() { return StaticBatchOpenGLHandler{}; }
+#endif
+
+#if defined(PARTEE_GL_CORE)
+        // Streams one instance per quad and draws each run of quads sharing a texture with one instanced call.
+        struct GLCoreHandler {
+            void operator()(std::span<const QuadRenderCommand> commands, const RenderContext<GLCoreRenderer>& context) const {
+                GLCoreRenderer::InstanceRange instances = context.renderer->allocateInstances(commands.size());
+                if (!instances.data) {
+                    return;
+                }
+                jobs::JobSystem::parallelFor(commands.size(), 4096, [&](size_t begin, size_t end) {
+                    gl::writeInstances(commands.subspan(begin, end - begin), instances.data + begin);
+                });
+
+                size_t first = 0;
+                for (size_t i = 1; i <= commands.size(); ++i) {
+                    if (i == commands.size() || commands[i].texture != commands[first].texture) {
+                        context.renderer->drawQuads(instances, first, i - first, commands[first].texture);
+                        first = i;
+                    }
+                }
+            }
+        };
+        static RenderFunction<GLCoreRenderer, QuadRenderCommand> glCoreHandler() { return GLCoreHandler{}; }
+
+        // Each batch's instances stay on the GPU until the batch is rebuilt, so a static batch costs one draw call.
+        struct StaticBatchGLCoreHandler {
+            void operator()(std::span<const StaticQuadBatchCommand> commands, const RenderContext<GLCoreRenderer>& context) const {
+                for (const StaticQuadBatchCommand& command : commands) {
+                    const StaticQuadBatch& batch = *command.batch;
+                    context.renderer->drawRetainedQuads(&batch, batch.version, std::span<const QuadRenderCommand>(batch.quads), 0);
+                }
+            }
+        };
+        static RenderFunction<GLCoreRenderer, StaticQuadBatchCommand> staticBatchGLCoreHandler() { return StaticBatchGLCoreHandler{}; }
+#endif
     };
 
 }
\ No newline at end of file
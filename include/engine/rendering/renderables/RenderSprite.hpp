@@ -0,0 +1,65 @@
+#pragma once
+
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/entities/Component.hpp"
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/rendering/core/Culling.hpp"
+#include "engine/rendering/core/RenderModule.hpp"
+#include "engine/rendering/core/RenderFrame.hpp"
+#include "engine/rendering/core/SortKey.hpp"
+#include "engine/rendering/renderables/QuadRenderCommand.hpp"
+#include "engine/rendering/textures/TextureAtlas.hpp"
+#include "engine/util/Color.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+namespace parteeengine::rendering {
+
+    // Quad showing part of a texture atlas page, tinted by color. The transform's
+    // scale is the sprite's size in world units.
+    struct RenderSpriteComponent : public ComponentCRTP<RenderSpriteComponent> {
+        AtlasSprite sprite;
+        parteeengine::Color color;
+        uint8_t layer = 0; // Higher layers draw on top
+
+        RenderSpriteComponent() = default;
+        RenderSpriteComponent(const AtlasSprite& sprite, parteeengine::Color color = {}) : sprite(sprite), color(color) {}
+
+        // Sprites become QuadRenderCommands, drawn by the quad handlers. The atlas page is
+        // the key's texture, so within a layer every sprite on a page sorts into one run
+        // and draws with one texture bind. Sprites outside the frame's view are culled.
+        static GatherFunction gatherer() {
+            return std::function<void(RenderFrame&, const parteeengine::EntityManager&)>([](RenderFrame& frame, const parteeengine::EntityManager& entityManager) {
+                auto entities = entityManager.getEntityComponentPairs<RenderSpriteComponent>();
+                const CullBounds visibleBounds = frame.getView().visible;
+                frame.gatherParallel<QuadRenderCommand>(entities.size(), 4096, [&](size_t begin, size_t end, RenderCommandBucket<QuadRenderCommand>& bucket) {
+                    // Bounds are culled a block at a time, four sprites per SIMD test
+                    constexpr size_t BlockSize = 256;
+                    const Transform2d* transforms[BlockSize];
+                    float x[BlockSize], y[BlockSize], halfX[BlockSize], halfY[BlockSize];
+                    uint32_t visible[BlockSize];
+                    for (size_t blockBegin = begin; blockBegin < end; blockBegin += BlockSize) {
+                        const size_t blockSize = std::min(BlockSize, end - blockBegin);
+                        for (size_t i = 0; i < blockSize; ++i) {
+                            const Transform2d& transform = entityManager.getComponent<TransformComponent2d>(entities[blockBegin + i].first)->transform;
+                            transforms[i] = &transform;
+                            x[i] = transform.position.x;
+                            y[i] = transform.position.y;
+                            halfX[i] = 0.5f * transform.scale.x;
+                            halfY[i] = 0.5f * transform.scale.y;
+                        }
+                        const size_t visibleCount = cullBoxes(visibleBounds, x, y, halfX, halfY, blockSize, visible);
+                        for (size_t v = 0; v < visibleCount; ++v) {
+                            const RenderSpriteComponent& sprite = entities[blockBegin + visible[v]].second;
+                            bucket.emplace(SortKey::make(sprite.layer, sprite.color.a < 1.f, SortKey::QuadShader, sprite.sprite.texture),
+                                *transforms[visible[v]], sprite.color, sprite.sprite.texture, sprite.sprite.uv);
+                        }
+                    }
+                });
+            });
+        }
+    };
+
+} // namespace parteeengine::rendering
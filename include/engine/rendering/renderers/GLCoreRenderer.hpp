@@ -0,0 +1,201 @@
+#pragma once
+
+#include "engine/assets/VirtualFileSystem.hpp"
+#include "engine/rendering/renderers/IRenderer.hpp"
+#include "engine/rendering/renderers/glcore/GLContext.hpp"
+#include "engine/rendering/renderers/glcore/GLFunctions.hpp"
+#include "engine/rendering/renderers/glcore/InstanceData.hpp"
+#include "engine/rendering/renderers/glcore/ProgramCache.hpp"
+#include "engine/rendering/renderers/glcore/StreamRingBuffer.hpp"
+#include "engine/rendering/windows/IWindow.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace parteeengine::assets {
+    struct Mesh;
+    struct MeshVertex;
+} // namespace parteeengine::assets
+
+namespace parteeengine::rendering {
+
+    template<typename CommandType>
+    struct RenderCommandBucket;
+
+    // OpenGL 3.3 core-profile renderer. Draws with the shaders in assets/shaders,
+    // compiled with INSTANCED defined, and streams per-instance data through a
+    // ring of persistently mapped buffers, so a run of quads or copies of a mesh
+    // is one instanced draw call. Linked programs are cached on disk.
+    //
+    // Textures are TextureRegistry ids, uploaded with mipmaps the first time they are
+    // drawn and again whenever the registry has a newer version.
+    //
+    // Without a window surface (any non-Windows platform for now) it renders into
+    // an offscreen framebuffer, which works on Mesa's llvmpipe without a GPU; read
+    // frames back with readPixels(), or they are copied into the window's pixel
+    // surface when it has one (OffscreenWindow).
+    class GLCoreRenderer : public IRenderer {
+    public:
+        struct InstanceRange {
+            gl::InstanceData* data = nullptr;
+            size_t count = 0;
+            size_t offset = 0; // Byte offset in the stream buffer
+        };
+
+        static constexpr const char* VertexShaderPath = "assets/shaders/vertexShader.glsl";
+        static constexpr const char* FragmentShaderPath = "assets/shaders/fragShader.glsl";
+
+        GLCoreRenderer();
+        ~GLCoreRenderer() override;
+
+        bool initialize(IWindow& window) override;
+        bool render(RenderFrame& frame, IWindow& window) override;
+
+        template<typename TCommand>
+        void registerHandler(RenderFunction<GLCoreRenderer, TCommand> fn);
+
+        // render() without the handler dispatch, for pipelines that call their handlers
+        // themselves (RenderHandlers): beginFrame binds the target and program and returns
+        // the context to pass them; endFrame finishes the frame.
+        RenderContext<GLCoreRenderer> beginFrame(RenderFrame& frame, IWindow& window);
+        void endFrame(IWindow& window);
+
+        // Reads shaders through the engine's file system so packs apply; loose files otherwise. Call before initialize.
+        GLCoreRenderer& setFileSystem(const assets::VirtualFileSystem* fileSystem);
+        // Where linked programs are cached. Empty disables the cache. Call before initialize.
+        GLCoreRenderer& setProgramCacheDirectory(std::filesystem::path directory);
+
+        // For render handlers. Reserves this frame's instance data; every instance must
+        // be written before drawing from the range. data is null if it can't be allocated.
+        InstanceRange allocateInstances(size_t count);
+        // Draws instances [first, first + count) of range as unit quads centered on their position.
+        void drawQuads(const InstanceRange& range, size_t first, size_t count, uint32_t texture);
+        // Draws instances [first, first + count) of range with every submesh of mesh. The mesh is
+        // uploaded on first use and released once it hasn't been drawn for a while.
+        void drawMesh(const assets::Mesh& mesh, const InstanceRange& range, size_t first, size_t count, uint32_t texture);
+        // Draws commands as unit quads from instance data kept on the GPU between frames.
+        // The data is written on first use and whenever version changes, and released once
+        // owner hasn't been drawn for a while. Command needs a Transform2d transform and a Color color.
+        template<typename Command>
+        void drawRetainedQuads(const void* owner, uint64_t version, std::span<const Command> commands, uint32_t texture);
+
+        // Copies the last rendered frame into rgba as RGBA8 rows, top row first.
+        bool readPixels(std::vector<uint8_t>& rgba, int& width, int& height);
+
+        uint64_t getFrameCount() const { return frameCount; }
+        // Draw calls issued by the last frame.
+        uint32_t getDrawCallCount() const { return drawCalls; }
+        const gl::ProgramCache& getProgramCache() const { return programCache; }
+        bool hasPersistentMapping() const { return stream.isPersistent(); }
+
+    private:
+        struct Geometry {
+            GLuint vertexArray = 0;
+            GLuint vertexBuffer = 0;
+            GLuint indexBuffer = 0;
+        };
+
+        struct RetainedInstances {
+            GLuint buffer = 0;
+            size_t count = 0;
+            uint64_t version = 0;
+            uint64_t lastUsedFrame = 0;
+        };
+
+        struct GpuTexture {
+            GLuint texture = 0;
+            uint64_t version = 0;
+            uint64_t lastUsedFrame = 0;
+        };
+
+        struct GpuMesh {
+            Geometry geometry;
+            uint64_t lastUsedFrame = 0;
+        };
+
+        // Uploads the vertices and indices and sets up the per-vertex and per-instance attributes.
+        Geometry createGeometry(std::span<const assets::MeshVertex> vertices, std::span<const uint32_t> indices);
+        void destroyGeometry(Geometry& geometry);
+        void drawInstanced(const Geometry& geometry, size_t firstIndex, size_t indexCount,
+            const InstanceRange& range, size_t first, size_t count, uint32_t texture);
+        // Draws count instances whose data starts at byte offset in buffer.
+        void drawInstances(const Geometry& geometry, size_t firstIndex, size_t indexCount,
+            GLuint buffer, size_t offset, size_t count, uint32_t texture);
+        // Binds the registry texture, uploading it first if it's new or changed. Unknown ids bind white.
+        void bindTexture(uint32_t texture);
+        // Uploads scratchInstances into retained.buffer.
+        void uploadRetained(RetainedInstances& retained);
+        bool readShader(const char* path, std::string& source);
+        void resizeTarget(int width, int height);
+        // Reads the target into rgba as RGBA8 rows, top row first.
+        void readTarget(uint8_t* rgba);
+        void releaseUnusedResources();
+
+        gl::GLContext context;
+        gl::ProgramCache programCache;
+        gl::StreamRingBuffer stream;
+        const assets::VirtualFileSystem* fileSystem = nullptr;
+        assets::VirtualFileSystem looseFiles; // Used when no file system is set
+
+        GLuint program = 0;
+        GLint projectionLocation = -1;
+        GLint viewLocation = -1;
+        GLint textureLocation = -1;
+        GLuint whiteTexture = 0;  // Bound for untextured draws, so one program serves both
+        uint32_t boundTexture = 0;
+        Geometry quad;
+
+        GLuint framebuffer = 0;   // Offscreen target, 0 when drawing to the window
+        GLuint colorBuffer = 0;
+        int targetWidth = 0;
+        int targetHeight = 0;
+        std::vector<uint8_t> flipRow;
+
+        std::unordered_map<uint64_t, GpuMesh> meshes; // By Mesh::id
+        std::unordered_map<const void*, RetainedInstances> retained;
+        std::unordered_map<uint32_t, GpuTexture> textures; // By TextureRegistry id
+        std::vector<gl::InstanceData> scratchInstances; // Retained data is written here before upload
+
+        uint64_t frameCount = 0;
+        uint32_t drawCalls = 0;
+
+        std::unordered_map<std::type_index, std::function<void(IRenderCommandBucket&, const RenderRun&, const RenderContext<GLCoreRenderer>&)>> handlers;
+    };
+
+    template<>
+    struct RenderContext<GLCoreRenderer> {
+        GLCoreRenderer* renderer;
+        uint64_t frameIndex;
+    };
+
+    template<typename Command>
+    void GLCoreRenderer::drawRetainedQuads(const void* owner, uint64_t version, std::span<const Command> commands, uint32_t texture) {
+        if (commands.empty()) {
+            return;
+        }
+        RetainedInstances& instances = retained[owner];
+        if (instances.version != version || instances.count != commands.size()) {
+            scratchInstances.resize(commands.size());
+            gl::writeInstances(commands, scratchInstances.data());
+            uploadRetained(instances);
+            instances.version = version;
+        }
+        instances.lastUsedFrame = frameCount;
+        drawInstances(quad, 0, 6, instances.buffer, 0, instances.count, texture);
+    }
+
+    template<typename TCommand>
+    void GLCoreRenderer::registerHandler(RenderFunction<GLCoreRenderer, TCommand> fn) {
+        handlers[std::type_index(typeid(TCommand))] = [fn](IRenderCommandBucket& bucket, const RenderRun& run, const RenderContext<GLCoreRenderer>& ctx) {
+            auto& typed = static_cast<RenderCommandBucket<TCommand>&>(bucket);
+            fn(typed.getCommands().subspan(run.begin, run.count), ctx);
+        };
+    }
+
+} // namespace parteeengine::rendering
@@ -12,6 +12,8 @@ namespace parteeengine::rendering {
     class IWindow;
 
     class IRenderer {
+    public:
+        virtual ~IRenderer() = default;
 
         virtual bool initialize(IWindow& window) = 0;
 
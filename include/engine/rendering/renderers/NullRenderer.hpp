@@ -0,0 +1,54 @@
+#pragma once
+
+#include "engine/rendering/renderers/IRenderer.hpp"
+#include "engine/rendering/windows/IWindow.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <typeindex>
+#include <unordered_map>
+
+namespace parteeengine::rendering {
+
+    template<typename CommandType>
+    struct RenderCommandBucket;
+
+    // Renderer that never touches a graphics API. Registered handlers are still
+    // dispatched, so a handler can capture commands to memory; buckets without a
+    // handler are dropped. Used for headless runs.
+    class NullRenderer : public IRenderer {
+    public:
+        bool initialize(IWindow& window) override;
+        bool render(RenderFrame& frame, IWindow& window) override;
+
+        template<typename TCommand>
+        void registerHandler(RenderFunction<NullRenderer, TCommand> fn);
+
+        // render() without the handler dispatch, for pipelines that call their handlers themselves (RenderHandlers).
+        RenderContext<NullRenderer> beginFrame(RenderFrame& frame, IWindow& window);
+        void endFrame(IWindow& window);
+
+        // Number of frames submitted since initialize().
+        uint64_t getFrameCount() const { return frameCount; }
+
+    private:
+        uint64_t frameCount = 0;
+
+        std::unordered_map<std::type_index, std::function<void(IRenderCommandBucket&, const RenderRun&, const RenderContext<NullRenderer>&)>> handlers;
+    };
+
+    template<>
+    struct RenderContext<NullRenderer> {
+        uint64_t frameIndex;
+    };
+
+    template<typename TCommand>
+    void NullRenderer::registerHandler(RenderFunction<NullRenderer, TCommand> fn) {
+        handlers[std::type_index(typeid(TCommand))] = [fn](IRenderCommandBucket& bucket, const RenderRun& run, const RenderContext<NullRenderer>& ctx) {
+            auto& typed = static_cast<RenderCommandBucket<TCommand>&>(bucket);
+            fn(typed.getCommands().subspan(run.begin, run.count), ctx);
+        };
+    }
+
+} // namespace parteeengine::rendering
@@ -5,5 +5,6 @@ namespace parteeengine::rendering {
     struct RenderContext<OpenGLRenderer> {
         HDC hdc;
         HGLRC hglrc;
+        OpenGLRenderer* renderer;
     };
 }
\ No newline at end of file
@@ -8,7 +8,10 @@
 #endif
 #include <windows.h>
 #include <GL/gl.h>
+#include <cstdint>
+#include <span>
 #include <typeindex>
+#include <unordered_map>
 
 namespace parteeengine::rendering {
 
@@ -24,18 +27,32 @@ namespace parteeengine::rendering {
         template<typename TCommand>
         void registerHandler(RenderFunction<OpenGLRenderer, TCommand> fn);
 
+        // render() without the handler dispatch, for pipelines that call their handlers themselves (RenderHandlers).
+        RenderContext<OpenGLRenderer> beginFrame(RenderFrame& frame, IWindow& window);
+        void endFrame(IWindow& window);
+
+        // For render handlers. GL name of a TextureRegistry texture, uploaded on first use and
+        // whenever the registry has a newer version. 0 for untextured or unknown ids.
+        GLuint getTexture(uint32_t texture);
+
     private:
+        struct GpuTexture {
+            GLuint texture = 0;
+            uint64_t version = 0;
+        };
+
         HDC hdc = nullptr;
         HGLRC hglrc = nullptr;
+        std::unordered_map<uint32_t, GpuTexture> textures; // By TextureRegistry id
 
-        std::unordered_map<std::type_index, std::function<void(IRenderCommandBucket&, const RenderContext<OpenGLRenderer>&)>> handlers;
+        std::unordered_map<std::type_index, std::function<void(IRenderCommandBucket&, const RenderRun&, const RenderContext<OpenGLRenderer>&)>> handlers;
     };
 
     template<typename TCommand>
     void OpenGLRenderer::registerHandler(RenderFunction<OpenGLRenderer, TCommand> fn) {
-        handlers[std::type_index(typeid(TCommand))] = [fn](IRenderCommandBucket& bucket, const RenderContext<OpenGLRenderer>& ctx) {
+        handlers[std::type_index(typeid(TCommand))] = [fn](IRenderCommandBucket& bucket, const RenderRun& run, const RenderContext<OpenGLRenderer>& ctx) {
             auto& typed = static_cast<RenderCommandBucket<TCommand>&>(bucket);
-            fn(typed, ctx);
+            fn(typed.getCommands().subspan(run.begin, run.count), ctx);
         };
     }
 
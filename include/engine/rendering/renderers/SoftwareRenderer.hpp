@@ -0,0 +1,133 @@
+#pragma once
+
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/core/jobs/JobSystem.hpp"
+#include "engine/rendering/renderers/IRenderer.hpp"
+#include "engine/rendering/renderers/software/Framebuffer.hpp"
+#include "engine/rendering/windows/IWindow.hpp"
+#include "engine/util/Color.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace parteeengine::assets {
+    struct Mesh;
+} // namespace parteeengine::assets
+
+namespace parteeengine::rendering {
+
+    template<typename CommandType>
+    struct RenderCommandBucket;
+
+    // CPU rasterizer. Handlers queue flat-colored triangles; at the end of the
+    // frame they are binned into 64x64 pixel tiles, and the tiles are rasterized
+    // in parallel on the job system with SIMD edge functions and alpha blending.
+    // Each tile draws its triangles in submission order, so the image doesn't
+    // depend on the thread count. Textures are ignored.
+    //
+    // Needs no GPU or window system; the result is in getFramebuffer().
+    class SoftwareRenderer : public IRenderer {
+    public:
+        static constexpr int TileSize = 64;
+
+        // Corners in framebuffer pixels
+        struct Triangle {
+            float x[3];
+            float y[3];
+            Color color;
+        };
+
+        bool initialize(IWindow& window) override;
+        bool render(RenderFrame& frame, IWindow& window) override;
+
+        template<typename TCommand>
+        void registerHandler(RenderFunction<SoftwareRenderer, TCommand> fn);
+
+        // render() without the handler dispatch, for pipelines that call their handlers
+        // themselves (RenderHandlers): beginFrame sets up the view and returns the
+        // context to pass them; endFrame rasterizes what they queued.
+        RenderContext<SoftwareRenderer> beginFrame(RenderFrame& frame, IWindow& window);
+        void endFrame(IWindow& window);
+
+        SoftwareRenderer& setClearColor(Color color);
+
+        // For render handlers. Queues two triangles per command, a unit quad centered on
+        // the command's transform like the GL renderers draw it. Command needs a
+        // Transform2d transform and a Color color.
+        template<typename Command>
+        void drawQuads(std::span<const Command> commands);
+        // Queues every triangle of mesh, placed by transform in x/y.
+        void drawMesh(const assets::Mesh& mesh, const Transform2d& transform, const Color& color);
+
+        const software::Framebuffer& getFramebuffer() const { return framebuffer; }
+        uint64_t getFrameCount() const { return frameCount; }
+        // Triangles queued by the last frame.
+        size_t getTriangleCount() const { return triangleCount; }
+
+    private:
+        // Edge functions and pixel bounds of a queued triangle; bounds are empty if it covers no pixel
+        struct Setup {
+            float edgeA[3], edgeB[3], edgeC[3]; // w = A * x + B * y + C, positive inside
+            int minX, minY, maxX, maxY;         // Pixels, max exclusive
+            uint32_t topLeft;                   // Bit per edge: pixels exactly on it are inside
+        };
+
+        // Pixel = (m[0] x + m[2] y + m[4], m[1] x + m[3] y + m[5])
+        struct Affine {
+            float m[6];
+        };
+
+        std::span<Triangle> allocateTriangles(size_t count);
+        Affine toPixels(const Transform2d& transform) const;
+        void writeQuad(const Transform2d& transform, const Color& color, Triangle* out) const;
+        void setupTriangles();
+        void binTriangles();
+        void rasterizeTile(size_t tile);
+
+        software::Framebuffer framebuffer;
+        Color clearColor{0.2f, 0.2f, 0.2f, 1.f};
+        Affine view{};   // World to framebuffer pixels for the current frame
+        int scissorMinX = 0, scissorMinY = 0, scissorMaxX = 0, scissorMaxY = 0; // Viewport, max exclusive
+
+        std::vector<Triangle> triangles;
+        std::vector<float> vertexX, vertexY; // drawMesh's vertices in pixels
+        std::vector<Setup> setups;
+        std::vector<std::vector<uint32_t>> bins; // Triangle indices per tile, row major
+        int tilesX = 0;
+        int tilesY = 0;
+
+        uint64_t frameCount = 0;
+        size_t triangleCount = 0;
+
+        std::unordered_map<std::type_index, std::function<void(IRenderCommandBucket&, const RenderRun&, const RenderContext<SoftwareRenderer>&)>> handlers;
+    };
+
+    template<>
+    struct RenderContext<SoftwareRenderer> {
+        SoftwareRenderer* renderer;
+        uint64_t frameIndex;
+    };
+
+    template<typename TCommand>
+    void SoftwareRenderer::registerHandler(RenderFunction<SoftwareRenderer, TCommand> fn) {
+        handlers[std::type_index(typeid(TCommand))] = [fn](IRenderCommandBucket& bucket, const RenderRun& run, const RenderContext<SoftwareRenderer>& ctx) {
+            auto& typed = static_cast<RenderCommandBucket<TCommand>&>(bucket);
+            fn(typed.getCommands().subspan(run.begin, run.count), ctx);
+        };
+    }
+
+    template<typename Command>
+    void SoftwareRenderer::drawQuads(std::span<const Command> commands) {
+        Triangle* out = allocateTriangles(commands.size() * 2).data();
+        jobs::JobSystem::parallelFor(commands.size(), 4096, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                writeQuad(commands[i].transform, commands[i].color, out + i * 2);
+            }
+        });
+    }
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+
+namespace parteeengine::rendering {
+
+    class IWindow;
+
+    namespace gl {
+
+        // Core-profile OpenGL context. On Windows it is created for the window's device
+        // context through WGL_ARB_create_context and draws to the window. Elsewhere it is
+        // a surfaceless EGL context, which Mesa provides with llvmpipe on machines without
+        // a GPU or display; drawing then goes to a framebuffer object.
+        class GLContext {
+        public:
+            GLContext() = default;
+            ~GLContext();
+
+            GLContext(const GLContext&) = delete;
+            GLContext& operator=(const GLContext&) = delete;
+
+            // Creates a context of at least version major.minor and makes it current.
+            bool create(IWindow& window, int major, int minor);
+            void destroy();
+
+            // Entry point lookup for gl::loadFunctions.
+            static void* getProcAddress(const char* name);
+
+            // True when there is no window surface to draw to.
+            bool isOffscreen() const;
+            const std::string& getError() const { return error; }
+
+        private:
+            void* display = nullptr; // HDC on Windows, EGLDisplay elsewhere
+            void* context = nullptr; // HGLRC on Windows, EGLContext elsewhere
+            std::string error;
+        };
+
+    } // namespace gl
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <GL/glcorearb.h>
+
+namespace parteeengine::rendering::gl {
+
+    // Core-profile entry points used by the GL core renderer, loaded at runtime
+    // because neither opengl32.dll nor libEGL exports anything past GL 1.1.
+    // Called as gl::Name(...) for glName; the GL_* constants come from glcorearb.h.
+#define PARTEE_GL_REQUIRED_FUNCTIONS(X) \
+    X(void, Clear, (GLbitfield mask)) \
+    X(void, ClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)) \
+    X(void, Viewport, (GLint x, GLint y, GLsizei width, GLsizei height)) \
+    X(void, Enable, (GLenum cap)) \
+    X(void, Disable, (GLenum cap)) \
+    X(void, BlendFunc, (GLenum sfactor, GLenum dfactor)) \
+    X(const GLubyte*, GetString, (GLenum name)) \
+    X(const GLubyte*, GetStringi, (GLenum name, GLuint index)) \
+    X(void, GetIntegerv, (GLenum pname, GLint* data)) \
+    X(GLenum, GetError, ()) \
+    X(void, Finish, ()) \
+    X(void, ReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)) \
+    X(void, PixelStorei, (GLenum pname, GLint param)) \
+    X(void, GenTextures, (GLsizei n, GLuint* textures)) \
+    X(void, DeleteTextures, (GLsizei n, const GLuint* textures)) \
+    X(void, BindTexture, (GLenum target, GLuint texture)) \
+    X(void, ActiveTexture, (GLenum texture)) \
+    X(void, TexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)) \
+    X(void, TexParameteri, (GLenum target, GLenum pname, GLint param)) \
+    X(void, GenerateMipmap, (GLenum target)) \
+    X(void, GenBuffers, (GLsizei n, GLuint* buffers)) \
+    X(void, DeleteBuffers, (GLsizei n, const GLuint* buffers)) \
+    X(void, BindBuffer, (GLenum target, GLuint buffer)) \
+    X(void, BufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage)) \
+    X(void*, MapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)) \
+    X(GLboolean, UnmapBuffer, (GLenum target)) \
+    X(void, GenVertexArrays, (GLsizei n, GLuint* arrays)) \
+    X(void, DeleteVertexArrays, (GLsizei n, const GLuint* arrays)) \
+    X(void, BindVertexArray, (GLuint array)) \
+    X(void, EnableVertexAttribArray, (GLuint index)) \
+    X(void, VertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)) \
+    X(void, VertexAttribDivisor, (GLuint index, GLuint divisor)) \
+    X(void, DrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount)) \
+    X(GLuint, CreateShader, (GLenum type)) \
+    X(void, ShaderSource, (GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)) \
+    X(void, CompileShader, (GLuint shader)) \
+    X(void, GetShaderiv, (GLuint shader, GLenum pname, GLint* params)) \
+    X(void, GetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)) \
+    X(void, DeleteShader, (GLuint shader)) \
+    X(GLuint, CreateProgram, ()) \
+    X(void, AttachShader, (GLuint program, GLuint shader)) \
+    X(void, DetachShader, (GLuint program, GLuint shader)) \
+    X(void, LinkProgram, (GLuint program)) \
+    X(void, GetProgramiv, (GLuint program, GLenum pname, GLint* params)) \
+    X(void, GetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)) \
+    X(void, DeleteProgram, (GLuint program)) \
+    X(void, UseProgram, (GLuint program)) \
+    X(GLint, GetUniformLocation, (GLuint program, const GLchar* name)) \
+    X(void, Uniform1i, (GLint location, GLint v0)) \
+    X(void, Uniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)) \
+    X(void, UniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)) \
+    X(GLsync, FenceSync, (GLenum condition, GLbitfield flags)) \
+    X(GLenum, ClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    X(void, DeleteSync, (GLsync sync)) \
+    X(void, GenFramebuffers, (GLsizei n, GLuint* framebuffers)) \
+    X(void, DeleteFramebuffers, (GLsizei n, const GLuint* framebuffers)) \
+    X(void, BindFramebuffer, (GLenum target, GLuint framebuffer)) \
+    X(void, FramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)) \
+    X(GLenum, CheckFramebufferStatus, (GLenum target)) \
+    X(void, GenRenderbuffers, (GLsizei n, GLuint* renderbuffers)) \
+    X(void, DeleteRenderbuffers, (GLsizei n, const GLuint* renderbuffers)) \
+    X(void, BindRenderbuffer, (GLenum target, GLuint renderbuffer)) \
+    X(void, RenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height))
+
+    // Newer than 3.3; null when the driver doesn't have them, and the renderer falls back.
+#define PARTEE_GL_OPTIONAL_FUNCTIONS(X) \
+    X(void, BufferStorage, (GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)) \
+    X(void, ProgramParameteri, (GLuint program, GLenum pname, GLint value)) \
+    X(void, GetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary)) \
+    X(void, ProgramBinary, (GLuint program, GLenum binaryFormat, const void* binary, GLsizei length))
+
+#define PARTEE_GL_DECLARE(ret, name, params) \
+    using name##Function = ret (APIENTRY*) params; \
+    inline name##Function name = nullptr;
+
+    PARTEE_GL_REQUIRED_FUNCTIONS(PARTEE_GL_DECLARE)
+    PARTEE_GL_OPTIONAL_FUNCTIONS(PARTEE_GL_DECLARE)
+
+#undef PARTEE_GL_DECLARE
+
+    using ProcAddressLoader = void* (*)(const char* name);
+
+    // Resolves every entry point through loader. Needs a current context on Windows.
+    // Returns false, naming the first one missing in missing, if a required function is absent.
+    bool loadFunctions(ProcAddressLoader loader, const char** missing = nullptr);
+
+    // True if the current context reports the extension, e.g. "GL_ARB_buffer_storage".
+    bool hasExtension(const char* name);
+
+    // Current context version as major * 10 + minor, e.g. 45 for 4.5.
+    int getVersion();
+
+} // namespace parteeengine::rendering::gl
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/rendering/batching/QuadBatchBuilder.hpp"
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numbers>
+#include <span>
+
+namespace parteeengine::rendering::gl {
+
+    // Per-instance vertex data streamed to the instanced shaders: the 2D transform
+    // as a 2x2 basis plus a translation, a packed color and a packed texture
+    // rectangle. 36 bytes instead of a full mat4, vec4 color and vec4 rectangle.
+    struct InstanceData {
+        float basis[4];   // Columns of the scaled rotation: (x axis, y axis)
+        float offset[2];  // Translation
+        uint32_t color;   // RGBA8, red in the lowest byte
+        uint16_t uv[4];   // UvRect u0, v0, u1, v1, normalized to 0..65535
+    };
+
+    inline uint16_t packUv(float value) {
+        return static_cast<uint16_t>(std::clamp(value, 0.f, 1.f) * 65535.f + 0.5f);
+    }
+
+    // Writes one instance per command from its transform, color and, if it has one, uv
+    // rectangle (the whole texture otherwise), four at a time with SIMD.
+    template<typename Command>
+    void writeInstances(std::span<const Command> commands, InstanceData* out) {
+        using namespace simd;
+        constexpr float DegreesToRadians = std::numbers::pi_v<float> / 180.f;
+
+        for (size_t base = 0; base < commands.size(); base += Width) {
+            const size_t lanes = std::min<size_t>(Width, commands.size() - base);
+
+            alignas(16) float angle[Width] = {}, scaleX[Width] = {}, scaleY[Width] = {};
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                const Transform2d& t = commands[base + lane].transform;
+                angle[lane] = t.rotation * DegreesToRadians;
+                scaleX[lane] = t.scale.x;
+                scaleY[lane] = t.scale.y;
+            }
+
+            Float4 sine, cosine;
+            sinCos(load(angle), sine, cosine);
+            alignas(16) float xx[Width], xy[Width], yx[Width], yy[Width];
+            store(xx, load(scaleX) * cosine);
+            store(xy, load(scaleX) * sine);
+            store(yx, set1(0.f) - load(scaleY) * sine);
+            store(yy, load(scaleY) * cosine);
+
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                const Command& command = commands[base + lane];
+                InstanceData& instance = out[base + lane];
+                instance = InstanceData{
+                    {xx[lane], xy[lane], yx[lane], yy[lane]},
+                    {command.transform.position.x, command.transform.position.y},
+                    QuadBatchBuilder::packColor(command.color),
+                    {0, 0, 65535, 65535}
+                };
+                if constexpr (requires { command.uv; }) {
+                    instance.uv[0] = packUv(command.uv.u0);
+                    instance.uv[1] = packUv(command.uv.v0);
+                    instance.uv[2] = packUv(command.uv.u1);
+                    instance.uv[3] = packUv(command.uv.v1);
+                }
+            }
+        }
+    }
+
+} // namespace parteeengine::rendering::gl
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "engine/rendering/renderers/glcore/GLFunctions.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace parteeengine::rendering::gl {
+
+    // Builds shader programs and keeps their linked binaries on disk, so later runs
+    // skip compiling and linking. Entries are keyed by a hash of the sources, the
+    // defines and the driver identification strings; a binary the driver rejects
+    // is rebuilt from source and overwritten. Needs a current context.
+    class ProgramCache {
+    public:
+        // Looks up driver support. Call once the context is current and functions are loaded.
+        void initialize();
+
+        // Directory for cached binaries; created when first written. Empty disables the disk cache.
+        ProgramCache& setDirectory(std::filesystem::path directory);
+
+        // Returns a linked program, or 0 with the compile or link log in getError().
+        // defines is inserted after each source's #version line.
+        GLuint build(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines = {});
+
+        // True if the driver can hand out program binaries at all.
+        bool isSupported() const { return supported; }
+        uint32_t getHits() const { return hits; }
+        uint32_t getMisses() const { return misses; }
+        const std::string& getError() const { return error; }
+
+    private:
+        struct FileHeader {
+            char magic[4];
+            uint32_t version;
+            uint64_t key;
+            uint32_t format;  // Driver binary format enum
+            uint32_t length;
+        };
+        static constexpr char Magic[4] = {'P', 'P', 'R', 'G'};
+        static constexpr uint32_t Version = 1;
+
+        GLuint loadBinary(uint64_t key);
+        void storeBinary(uint64_t key, GLuint program);
+        GLuint compileAndLink(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines);
+        std::filesystem::path pathFor(uint64_t key) const;
+
+        std::filesystem::path directory;
+        std::string driver; // Vendor, renderer and version strings, part of every key
+        bool supported = false;
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        std::string error;
+    };
+
+} // namespace parteeengine::rendering::gl
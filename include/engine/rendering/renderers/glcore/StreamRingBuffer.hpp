@@ -0,0 +1,67 @@
+#pragma once
+
+#include "engine/rendering/renderers/glcore/GLFunctions.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace parteeengine::rendering::gl {
+
+    // Vertex buffer for data rewritten every frame, split into one region per frame
+    // in flight. Each frame writes into the next region and fences it on submit, so
+    // the CPU only waits when it runs FramesInFlight frames ahead of the GPU.
+    //
+    // With GL 4.4 or ARB_buffer_storage the whole buffer stays persistently mapped
+    // and allocations are plain pointers into it. Otherwise each allocation is an
+    // unsynchronized map of its range, which commit() unmaps before drawing.
+    class StreamRingBuffer {
+    public:
+        static constexpr size_t FramesInFlight = 3;
+
+        struct Allocation {
+            void* data = nullptr;
+            size_t offset = 0; // Byte offset into getBuffer(), for attribute pointers
+        };
+
+        StreamRingBuffer() = default;
+        ~StreamRingBuffer();
+
+        StreamRingBuffer(const StreamRingBuffer&) = delete;
+        StreamRingBuffer& operator=(const StreamRingBuffer&) = delete;
+
+        // Needs a current context. regionSize is the starting per-frame capacity in bytes.
+        bool create(size_t regionSize, bool persistent);
+        void destroy();
+
+        // Waits until the GPU is done with the region this frame reuses.
+        void beginFrame();
+        // Fences the frame's region.
+        void endFrame();
+
+        // Reserves bytes in this frame's region, growing the buffer if it doesn't fit.
+        // The data must be written before the next allocate() and before drawing from it.
+        Allocation allocate(size_t bytes, size_t alignment = 16);
+        // Makes written data visible to draws. A no-op for persistent mappings.
+        void commit();
+
+        GLuint getBuffer() const { return buffer; }
+        size_t getRegionSize() const { return regionSize; }
+        bool isPersistent() const { return persistent; }
+
+    private:
+        bool allocateStorage();
+        void releaseStorage();
+        void waitForRegion(size_t index);
+        void grow(size_t required);
+
+        GLuint buffer = 0;
+        unsigned char* mapping = nullptr; // Whole buffer when persistent
+        size_t regionSize = 0;
+        size_t region = 0;    // Region written this frame
+        size_t head = 0;      // Bytes used in it
+        bool persistent = false;
+        bool mapped = false;  // Non-persistent range awaiting commit()
+        std::array<GLsync, FramesInFlight> fences{};
+    };
+
+} // namespace parteeengine::rendering::gl
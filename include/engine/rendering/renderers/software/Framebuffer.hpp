@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace parteeengine::rendering::software {
+
+    // RGBA8 image in memory, rows top to bottom, red in the lowest byte of a pixel.
+    class Framebuffer {
+    public:
+        void resize(int width, int height);
+        void clear(uint32_t color);
+
+        int getWidth() const { return width; }
+        int getHeight() const { return height; }
+        uint32_t* data() { return pixels.data(); }
+        const uint32_t* data() const { return pixels.data(); }
+        uint32_t getPixel(int x, int y) const { return pixels[size_t(y) * size_t(width) + size_t(x)]; }
+
+        // Binary PPM (P6); alpha is dropped.
+        bool writePpm(const std::filesystem::path& path) const;
+        // 8-bit RGBA PNG. The image data is stored in uncompressed deflate blocks:
+        // larger files, but no zlib dependency and still readable everywhere.
+        bool writePng(const std::filesystem::path& path) const;
+        // PNG for a .png extension, PPM otherwise.
+        bool write(const std::filesystem::path& path) const;
+
+    private:
+        int width = 0;
+        int height = 0;
+        std::vector<uint32_t> pixels;
+    };
+
+} // namespace parteeengine::rendering::software
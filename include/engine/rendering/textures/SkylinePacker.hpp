@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // Packs rectangles into a fixed-size bin, one at a time, with the skyline
+    // bottom-left heuristic: the bin's filled area is kept as a list of horizontal
+    // segments, and each rectangle goes where its top edge ends up lowest. Space
+    // under a segment's overhang is given up, which keeps every insert linear in
+    // the segment count.
+    class SkylinePacker {
+    public:
+        SkylinePacker() = default;
+        SkylinePacker(int width, int height) { reset(width, height); }
+
+        // Empties the bin and sets its size.
+        void reset(int width, int height);
+
+        // Places a width x height rectangle, writing its top left corner to x and y.
+        // Returns false, leaving the bin unchanged, if it doesn't fit.
+        bool insert(int width, int height, int& x, int& y);
+
+        int getWidth() const { return binWidth; }
+        int getHeight() const { return binHeight; }
+        // Fraction of the bin covered by rectangles.
+        float getOccupancy() const;
+
+    private:
+        struct Segment {
+            int x;
+            int y;     // Top of the filled area under this segment
+            int width;
+        };
+
+        // Top edge y of a rectangle placed at segment index, or -1 if it doesn't fit there.
+        int fit(size_t index, int width, int height) const;
+
+        std::vector<Segment> skyline; // Left to right, covering the bin's width
+        int binWidth = 0;
+        int binHeight = 0;
+        uint64_t usedArea = 0;
+    };
+
+} // namespace parteeengine::rendering
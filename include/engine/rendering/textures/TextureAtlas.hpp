@@ -0,0 +1,88 @@
+#pragma once
+
+#include "engine/rendering/renderables/QuadRenderCommand.hpp"
+#include "engine/rendering/textures/SkylinePacker.hpp"
+#include "engine/rendering/textures/TextureRegistry.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // Where an image ended up in an atlas: the page's texture and the part of it
+    // the image covers.
+    struct AtlasSprite {
+        uint32_t texture = 0; // TextureRegistry id of the page
+        UvRect uv;
+        int width = 0;        // Pixels
+        int height = 0;
+    };
+
+    // Packs images into a few large textures (pages), so sprites drawn from one
+    // page share a texture and batch into a single draw call. Each page is a
+    // SkylinePacker; images are added online, one at a time into the first page
+    // with room, or offline with pack(), which adds them largest first for a
+    // tighter fit.
+    //
+    // Every image is surrounded by padding pixels filled by extending its edge
+    // pixels outward, so bilinear filtering and the first mip levels (about
+    // log2(padding) + 1 of them) sample the image's own edge instead of a
+    // neighbour; pages cap their mip chain there. Pages are registered with the TextureRegistry when they are
+    // opened; changes reach the renderers on publish().
+    class TextureAtlas {
+    public:
+        struct Image {
+            std::string name;
+            std::span<const uint32_t> pixels; // RGBA8, red in the lowest byte, rows top to bottom
+            int width = 0;
+            int height = 0;
+        };
+
+        TextureAtlas() = default;
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+        ~TextureAtlas();
+
+        // Size of pages opened from now on. Defaults to 1024x1024.
+        TextureAtlas& setPageSize(int width, int height);
+        // Border around every image, in pixels. Defaults to 2. Call before adding images.
+        TextureAtlas& setPadding(int pixels);
+
+        // Adds an image under its name, replacing nothing: a name already in the atlas
+        // keeps its first image. Returns false if the image doesn't fit on an empty page.
+        bool add(const Image& image);
+        // Adds images largest first, then publishes. Returns how many were added.
+        size_t pack(std::span<const Image> images);
+        // Sends pages changed since the last publish to the TextureRegistry.
+        void publish();
+
+        // Null if no image has that name.
+        const AtlasSprite* find(std::string_view name) const;
+        size_t getPageCount() const { return pages.size(); }
+        const TextureImage& getPage(size_t index) const { return pages[index].image; }
+        // Fraction of the page covered by images and their padding.
+        float getOccupancy(size_t index) const { return pages[index].packer.getOccupancy(); }
+
+    private:
+        struct Page {
+            TextureImage image;
+            SkylinePacker packer;
+            uint32_t texture = 0;
+            bool dirty = false;
+        };
+
+        // Copies image into page with its corner at (x, y), and extends its edges over the padding around it.
+        void blit(Page& page, const Image& image, int x, int y) const;
+
+        std::vector<Page> pages;
+        std::unordered_map<std::string, AtlasSprite> sprites;
+        int pageWidth = 1024;
+        int pageHeight = 1024;
+        int padding = 2;
+    };
+
+} // namespace parteeengine::rendering
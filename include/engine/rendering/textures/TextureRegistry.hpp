@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // RGBA8 pixels with red in the lowest byte, rows top to bottom.
+    struct TextureImage {
+        std::vector<uint32_t> pixels;
+        int width = 0;
+        int height = 0;
+        // Deepest mip level renderers may build and sample. Atlas pages lower it to
+        // the levels their padding keeps sprites apart at.
+        int maxMipLevel = 1000;
+    };
+
+    // Process-wide table of CPU-side textures, so renderables name a texture by id
+    // without knowing which renderer draws them. Renderers upload a texture the
+    // first time they draw with it and again whenever its version changes. Id 0 is
+    // never assigned; commands use it for untextured. All calls are thread-safe.
+    class TextureRegistry {
+    public:
+        struct Entry {
+            std::shared_ptr<const TextureImage> image; // Null for an unknown id
+            uint64_t version = 0;
+        };
+
+        static uint32_t create(TextureImage image);
+        // Replaces the pixels of a texture. Returns false for an unknown id.
+        static bool update(uint32_t id, TextureImage image);
+        static void destroy(uint32_t id);
+
+        // The current image; later updates don't change it.
+        static Entry get(uint32_t id);
+        // 0 for an unknown id. Lets a renderer check its upload is current without taking the image.
+        static uint64_t getVersion(uint32_t id);
+
+    private:
+        static inline std::mutex mutex;
+        static inline std::unordered_map<uint32_t, Entry> textures;
+        static inline uint32_t nextId = 1;
+        static inline uint64_t nextVersion = 1; // Shared by every texture, so a reused id never repeats a version
+    };
+
+} // namespace parteeengine::rendering
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -11,26 +12,32 @@ namespace parteeengine::rendering {
         const char* title = "interpreter Window";
     };
 
-    // struct WindowEvent : public Event {
-    //     enum class Type {
-    //         Close,
-    //         Resize
-    //     };
+    struct WindowEvent {
+        enum class Type {
+            Close,
+            Resize
+        };
 
-    //     void subscribed() override {};
-
-    //     Type type;
+        Type type;
+        int width = 0;  // New client size for Resize events
+        int height = 0;
+    };
 
-    //     explicit WindowEvent(Type t) : type(t) {}
-    // };
+    // Color buffer in memory, RGBA8 with red in the lowest byte, rows top to bottom.
+    struct PixelSurface {
+        uint32_t* pixels = nullptr;
+        int width = 0;
+        int height = 0;
+    };
 
     // Platform-agnostic graphics context handle
     struct NativeGraphicsContext {
         void* deviceContext = nullptr;   // HDC on Windows, Display* on X11
         void* windowHandle = nullptr;    // HWND on Windows, Window on X11
+        PixelSurface* surface = nullptr; // Back buffer of windows without a display; renderers copy frames here
     };
 
-    // using WindowEventCallback = std::function<void(const WindowEvent&)>;
+    using WindowEventCallback = std::function<void(const WindowEvent&)>;
 
     class IWindow {
     public:
@@ -49,7 +56,7 @@ namespace parteeengine::rendering {
         virtual WindowConfig getConfig() const = 0;
         virtual void config(WindowConfig config) = 0;
 
-        // virtual void setEventCallback(WindowEventCallback callback) = 0;
+        virtual void setEventCallback(WindowEventCallback callback) = 0;
 
         static std::unique_ptr<IWindow> createPlatformWindow();
         
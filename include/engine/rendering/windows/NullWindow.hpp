@@ -0,0 +1,40 @@
+#pragma once
+
+#include "engine/rendering/windows/IWindow.hpp"
+
+namespace parteeengine::rendering {
+
+    // Window with no platform backing. Used for headless runs (dedicated servers,
+    // CI, benchmarks) where the module pipeline runs without a display.
+    class NullWindow : public IWindow {
+    public:
+        NullWindow() = default;
+        ~NullWindow() override = default;
+
+        bool create(const WindowConfig& config) override;
+        bool create() override;
+        bool destroy() override;
+        bool show() override;
+        bool hide() override;
+
+        bool swapBuffers() override;
+        bool pollEvents() override;
+
+        NativeGraphicsContext getNativeContext() const override;
+        WindowConfig getConfig() const override;
+        void config(WindowConfig config) override;
+
+        void setEventCallback(WindowEventCallback callback) override;
+
+        // Makes the next pollEvents() return false, as if the window was closed.
+        void requestClose();
+        // Changes the configured size and reports it like a platform resize.
+        void resize(int width, int height);
+
+    private:
+        WindowConfig windowConfig = {};
+        bool closeRequested = false;
+        WindowEventCallback eventCallback;
+    };
+
+} // namespace parteeengine::rendering
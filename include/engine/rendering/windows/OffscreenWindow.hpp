@@ -0,0 +1,109 @@
+#pragma once
+
+#include "engine/rendering/windows/IWindow.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace parteeengine::rendering {
+
+    // Window backed by pixel buffers in memory, for machines without a display.
+    // Renderers draw into the back buffer exposed as getNativeContext().surface;
+    // swapBuffers() presents it and moves on to the next buffer in the rotation.
+    // Events come from postEvent() instead of a window system.
+    //
+    // Presented frames can be streamed to a file as concatenated binary PPMs
+    // (ffmpeg reads them with -f image2pipe -c:v ppm) or published to a POSIX
+    // shared memory object that another process maps to watch the latest frame.
+    class OffscreenWindow : public IWindow {
+    public:
+        // Layout of the shared memory object: this header, then width * height RGBA8 pixels.
+        // sequence is odd while a frame is being written; readers copy the pixels and retry
+        // if it changed or was odd.
+        struct SharedFrameHeader {
+            char magic[4];                   // "PFRM"
+            uint32_t version;
+            std::atomic<uint64_t> sequence;
+            uint64_t frameIndex;
+            uint32_t width;
+            uint32_t height;
+        };
+        static constexpr uint32_t SharedFrameVersion = 1;
+
+        OffscreenWindow() = default;
+        ~OffscreenWindow() override;
+
+        bool create(const WindowConfig& config) override;
+        bool create() override;
+        bool destroy() override;
+        bool show() override;
+        bool hide() override;
+
+        bool swapBuffers() override;
+        bool pollEvents() override;
+
+        NativeGraphicsContext getNativeContext() const override;
+        WindowConfig getConfig() const override;
+        void config(WindowConfig config) override;
+
+        void setEventCallback(WindowEventCallback callback) override;
+
+        // Number of buffers in the rotation, at least 2. Call before create.
+        OffscreenWindow& setBufferCount(size_t count);
+        // Appends every presented frame to path as a binary PPM. Returns false if it can't be opened.
+        bool streamToFile(const std::filesystem::path& path);
+        // Publishes every presented frame to the shared memory object name (e.g. "/partee-frames").
+        // POSIX only; returns false elsewhere or if it can't be created. The object is removed
+        // again by stopStreaming() and on destruction; readers already attached keep their mapping.
+        bool streamToSharedMemory(const std::string& name);
+        void stopStreaming();
+
+        // Queues an event for the next pollEvents(). Safe to call from any thread.
+        void postEvent(const WindowEvent& event);
+        // Queues a Close event; the pollEvents() that handles it returns false.
+        void requestClose() { postEvent(WindowEvent{WindowEvent::Type::Close}); }
+        // Queues a Resize event; the buffers are resized when it is handled.
+        void resize(int width, int height) { postEvent(WindowEvent{WindowEvent::Type::Resize, width, height}); }
+
+        // The last presented frame; empty before the first swapBuffers().
+        std::span<const uint32_t> getFrontBuffer() const;
+        uint64_t getPresentedFrameCount() const { return presentedFrames; }
+
+    private:
+        void allocateBuffers();
+        void writeStreams(const std::vector<uint32_t>& frame);
+        bool mapSharedMemory();
+        void unmapSharedMemory();
+        // Removes the object named sharedMemoryName, if any.
+        void unlinkSharedMemory();
+
+        WindowConfig windowConfig = {};
+        WindowEventCallback eventCallback;
+        bool closed = false;
+
+        std::vector<std::vector<uint32_t>> buffers;
+        size_t bufferCount = 2;
+        size_t backBuffer = 0;
+        bool presented = false;
+        uint64_t presentedFrames = 0;
+        mutable PixelSurface surface; // Points at the back buffer
+
+        std::mutex eventMutex;
+        std::vector<WindowEvent> pendingEvents;
+        std::vector<WindowEvent> handledEvents; // Swapped with pendingEvents so draining doesn't allocate
+
+        std::ofstream fileStream;
+        std::vector<uint8_t> fileBytes;
+        std::string sharedMemoryName;
+        int sharedMemoryFile = -1;
+        void* sharedMemory = nullptr;
+        size_t sharedMemorySize = 0;
+    };
+
+} // namespace parteeengine::rendering
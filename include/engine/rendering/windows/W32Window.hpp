@@ -27,7 +27,7 @@ namespace parteeengine::rendering {
         WindowConfig getConfig() const override;
         void config(WindowConfig config);
 
-        // void setEventCallback(WindowEventCallback callback) override;
+        void setEventCallback(WindowEventCallback callback) override;
 
     private:
         static LRESULT CALLBACK WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
@@ -38,7 +38,7 @@ namespace parteeengine::rendering {
         
         WindowConfig windowConfig = {};
 
-        // WindowEventCallback eventCallback;
+        WindowEventCallback eventCallback;
 
     };
 
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "engine/util/Mat3.hpp"
+#include "engine/util/Mat4.hpp"
+
+#include <cstddef>
+
+namespace parteeengine::simd {
+
+    // Kernels over structure-of-arrays data, four elements per step on Float4 with a
+    // scalar tail. Outputs may alias the matching inputs.
+
+    // out = m * (x, y, z, 1) for count points.
+    void transformPoints(const Mat4& m, const float* x, const float* y, const float* z,
+                         float* outX, float* outY, float* outZ, size_t count);
+    // out = m * (x, y, 1) for count points; m is taken as a 2D affine transform.
+    void transformPoints(const Mat3& m, const float* x, const float* y, float* outX, float* outY, size_t count);
+
+} // namespace parteeengine::simd
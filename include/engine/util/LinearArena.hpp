@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace parteeengine {
+
+    // Bump allocator for data that lives until the next reset(). Nothing is freed
+    // individually and no destructors run, so it only holds trivially destructible
+    // data. When a reset finds the allocations spilled into more than one block,
+    // the blocks are merged into a single one big enough for all of them, so a
+    // steady workload settles on one block and stops allocating.
+    class LinearArena {
+    public:
+        explicit LinearArena(size_t initialCapacity = 64 * 1024);
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        // Never returns null. align must be a power of two.
+        void* allocate(size_t bytes, size_t align = alignof(std::max_align_t));
+
+        template<typename T>
+        T* allocate(size_t count) { return static_cast<T*>(allocate(count * sizeof(T), alignof(T))); }
+
+        // Invalidates every allocation.
+        void reset();
+
+        // Bytes handed out since the last reset, including alignment padding.
+        size_t getUsed() const { return used; }
+        size_t getCapacity() const;
+
+    private:
+        struct Block {
+            std::unique_ptr<std::byte[]> memory;
+            size_t size = 0;
+        };
+
+        void addBlock(size_t minimumSize);
+
+        std::vector<Block> blocks;
+        std::byte* cursor = nullptr;
+        std::byte* end = nullptr;
+        size_t used = 0;
+    };
+
+} // namespace parteeengine
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace parteeengine::lz4 {
+
+    // LZ4 block format (no frame header), compatible with LZ4_compress_default /
+    // LZ4_decompress_safe. The compressor is a plain greedy single-hash matcher:
+    // fast and dependency free, but a few percent larger than the reference one.
+
+    // Worst-case compressed size of n input bytes.
+    inline size_t compressBound(size_t n) { return n + n / 255 + 16; }
+
+    // Appends the compressed block to out and returns its size.
+    size_t compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out);
+
+    // Decompresses a block that expands to exactly dstSize bytes. Returns false on
+    // malformed input instead of reading or writing out of bounds.
+    bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+} // namespace parteeengine::lz4
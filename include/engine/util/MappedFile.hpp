@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace parteeengine {
+
+    // Read-only memory mapping of a whole file. The OS pages it in on demand, so
+    // opening is cheap regardless of size and reads are zero-copy.
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Maps the file, replacing any previous mapping. Returns false if it can't be opened or mapped.
+        bool open(const std::filesystem::path& filePath);
+        void close();
+
+        bool isOpen() const { return opened; }
+        const char* data() const { return bytes; }
+        size_t size() const { return length; }
+        std::string_view view() const { return {bytes, length}; }
+
+    private:
+        const char* bytes = nullptr;
+        size_t length = 0;
+        bool opened = false;
+#if defined(_WIN32)
+        void* fileHandle = nullptr;
+        void* mappingHandle = nullptr;
+#endif
+    };
+
+} // namespace parteeengine
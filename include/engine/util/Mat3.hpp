@@ -0,0 +1,63 @@
+#pragma once
+
+#include "engine/util/Mat4.hpp"
+#include "engine/util/Simd.hpp"
+#include "engine/util/Vector2.hpp"
+#include "engine/util/Vector3.hpp"
+#include "engine/util/Vector4.hpp"
+
+namespace parteeengine {
+
+    // 3x3 matrix, column major, mostly used as a 2D affine transform: columns[2]
+    // is the translation and the bottom row stays (0, 0, 1). Columns are padded
+    // to Vector4 (w = 0) so each loads as one SIMD register. Vectors are columns
+    // multiplied on the right, so a * b applies b first.
+    struct alignas(16) Mat3 {
+        Vector4 columns[3];
+
+        // Identity
+        Mat3() : columns{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}} {}
+        Mat3(const Vector3& c0, const Vector3& c1, const Vector3& c2) : columns{{c0, 0.f}, {c1, 0.f}, {c2, 0.f}} {}
+
+        static Mat3 identity() { return Mat3(); }
+        static Mat3 translation(const Vector2& offset);
+        static Mat3 scale(const Vector2& factors);
+        // Counterclockwise in a y-up frame, in degrees like Transform2d.
+        static Mat3 rotation(float degrees);
+        // translation * rotation * scale, the model matrix of a Transform2d with these fields.
+        static Mat3 transform2d(const Vector2& position, float degrees, const Vector2& scale);
+
+        Vector3 operator*(const Vector3& v) const {
+            simd::Float4 result = columns[0].toSimd() * simd::set1(v.x);
+            result = simd::mulAdd(columns[1].toSimd(), simd::set1(v.y), result);
+            result = simd::mulAdd(columns[2].toSimd(), simd::set1(v.z), result);
+            return Vector4::fromSimd(result).xyz();
+        }
+
+        Mat3 operator*(const Mat3& other) const {
+            return Mat3(*this * other.columns[0].xyz(), *this * other.columns[1].xyz(), *this * other.columns[2].xyz());
+        }
+
+        Mat3& operator*=(const Mat3& other) { return *this = *this * other; }
+
+        Vector2 transformPoint(const Vector2& point) const {
+            Vector3 result = *this * Vector3(point.x, point.y, 1.f);
+            return Vector2(result.x, result.y);
+        }
+        Vector2 transformDirection(const Vector2& direction) const {
+            Vector3 result = *this * Vector3(direction.x, direction.y, 0.f);
+            return Vector2(result.x, result.y);
+        }
+
+        float determinant() const;
+        Mat3 transposed() const;
+        // A singular matrix has no inverse and gives the identity.
+        Mat3 inverse() const;
+        // The 2D affine transform acting on x and y, leaving z alone.
+        Mat4 toMat4() const;
+
+        float& operator()(int row, int column) { return (&columns[column].x)[row]; }
+        float operator()(int row, int column) const { return (&columns[column].x)[row]; }
+    };
+
+} // namespace parteeengine
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "engine/util/Simd.hpp"
+#include "engine/util/Vector3.hpp"
+#include "engine/util/Vector4.hpp"
+
+namespace parteeengine {
+
+    // 4x4 matrix, column major like GL: data() can be passed to glUniformMatrix4fv
+    // as is, and columns[3] is the translation. Vectors are columns multiplied on
+    // the right, so a * b applies b first. Products run a column at a time on
+    // simd::Float4.
+    struct alignas(16) Mat4 {
+        Vector4 columns[4];
+
+        // Identity
+        Mat4() : columns{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}} {}
+        Mat4(const Vector4& c0, const Vector4& c1, const Vector4& c2, const Vector4& c3) : columns{c0, c1, c2, c3} {}
+
+        static Mat4 identity() { return Mat4(); }
+        static Mat4 translation(const Vector3& offset);
+        static Mat4 scale(const Vector3& factors);
+        // Counterclockwise about z in a y-up frame, in degrees like Transform2d.
+        static Mat4 rotationZ(float degrees);
+        // Maps the box to clip space, GL style: z from -near to -far lands in [-1, 1].
+        static Mat4 orthographic(float left, float right, float bottom, float top, float near, float far);
+
+        Vector4 operator*(const Vector4& v) const {
+            simd::Float4 value = v.toSimd();
+            simd::Float4 result = columns[0].toSimd() * simd::splat<0>(value);
+            result = simd::mulAdd(columns[1].toSimd(), simd::splat<1>(value), result);
+            result = simd::mulAdd(columns[2].toSimd(), simd::splat<2>(value), result);
+            result = simd::mulAdd(columns[3].toSimd(), simd::splat<3>(value), result);
+            return Vector4::fromSimd(result);
+        }
+
+        Mat4 operator*(const Mat4& other) const {
+            return Mat4(*this * other.columns[0], *this * other.columns[1], *this * other.columns[2], *this * other.columns[3]);
+        }
+
+        Mat4& operator*=(const Mat4& other) { return *this = *this * other; }
+
+        // w = 1: translated
+        Vector3 transformPoint(const Vector3& point) const { return (*this * Vector4(point, 1.f)).xyz(); }
+        // w = 0: not translated
+        Vector3 transformDirection(const Vector3& direction) const { return (*this * Vector4(direction, 0.f)).xyz(); }
+
+        Mat4 transposed() const;
+        // A singular matrix has no inverse and gives the identity.
+        Mat4 inverse() const;
+
+        float& operator()(int row, int column) { return data()[column * 4 + row]; }
+        float operator()(int row, int column) const { return data()[column * 4 + row]; }
+
+        float* data() { return &columns[0].x; }
+        const float* data() const { return &columns[0].x; }
+    };
+
+} // namespace parteeengine
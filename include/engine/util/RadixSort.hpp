@@ -0,0 +1,100 @@
+#pragma once
+
+#include "engine/core/jobs/JobSystem.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace parteeengine {
+
+    // Stable LSD radix sort on a 64-bit key, one byte per pass. Passes over bytes
+    // that are the same in every key are skipped, so keys that only use a few
+    // fields cost a few passes. Large inputs are split into chunks that build
+    // their histograms and scatter in parallel on the job system; each chunk
+    // writes to its own precomputed ranges, so the result is the same as serial.
+    //
+    // scratch must hold as many items; the sorted result ends up in items.
+    template<typename T, typename KeyFunction>
+    void radixSort(std::span<T> items, std::span<T> scratch, KeyFunction key) {
+        constexpr size_t MinChunkSize = 16384;
+        constexpr size_t MaxChunks = 16; // Bounds the histograms so they fit on the stack
+        using Histogram = std::array<uint32_t, 256>;
+
+        const size_t count = items.size();
+        if (count < 2) {
+            return;
+        }
+
+        const size_t chunkCount = std::clamp<size_t>(count / MinChunkSize, 1, std::min(MaxChunks, jobs::JobSystem::getConcurrency()));
+        const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+        auto forEachChunk = [&](auto&& fn) {
+            if (chunkCount == 1) {
+                fn(0, 0, count);
+                return;
+            }
+            jobs::JobSystem::parallelFor(chunkCount, 1, [&](size_t begin, size_t end) {
+                for (size_t chunk = begin; chunk < end; ++chunk) {
+                    fn(chunk, chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+                }
+            });
+        };
+
+        // Bits that differ anywhere decide which passes are needed
+        std::array<uint64_t, MaxChunks> chunkDifferences{};
+        const uint64_t firstKey = key(items[0]);
+        forEachChunk([&](size_t chunk, size_t begin, size_t end) {
+            uint64_t difference = 0;
+            for (size_t i = begin; i < end; ++i) {
+                difference |= key(items[i]) ^ firstKey;
+            }
+            chunkDifferences[chunk] = difference;
+        });
+        uint64_t difference = 0;
+        for (uint64_t chunkDifference : chunkDifferences) {
+            difference |= chunkDifference;
+        }
+
+        std::span<T> source = items, destination = scratch;
+        std::array<Histogram, MaxChunks> histograms;
+        for (int shift = 0; shift < 64; shift += 8) {
+            if (((difference >> shift) & 0xFF) == 0) {
+                continue;
+            }
+
+            forEachChunk([&](size_t chunk, size_t begin, size_t end) {
+                Histogram& histogram = histograms[chunk];
+                histogram.fill(0);
+                for (size_t i = begin; i < end; ++i) {
+                    ++histogram[(key(source[i]) >> shift) & 0xFF];
+                }
+            });
+
+            // Turn the counts into each chunk's first write position per digit: digit-major, then chunk order
+            uint32_t offset = 0;
+            for (size_t digit = 0; digit < 256; ++digit) {
+                for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                    uint32_t digitCount = histograms[chunk][digit];
+                    histograms[chunk][digit] = offset;
+                    offset += digitCount;
+                }
+            }
+
+            forEachChunk([&](size_t chunk, size_t begin, size_t end) {
+                Histogram& position = histograms[chunk];
+                for (size_t i = begin; i < end; ++i) {
+                    destination[position[(key(source[i]) >> shift) & 0xFF]++] = std::move(source[i]);
+                }
+            });
+            std::swap(source, destination);
+        }
+
+        if (source.data() != items.data()) {
+            std::move(source.begin(), source.end(), items.begin());
+        }
+    }
+
+} // namespace parteeengine
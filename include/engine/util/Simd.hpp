@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PARTEE_SIMD_SSE2 1
+#include <emmintrin.h>
+#if defined(__FMA__)
+#define PARTEE_SIMD_FMA 1
+#include <immintrin.h>
+#endif
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+// AArch64 only: the NEON path uses vdivq_f32, vsqrtq_f32, vfmaq_f32 and vdupq_laneq_f32,
+// which 32-bit ARM lacks, so it takes the scalar path.
+#define PARTEE_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define PARTEE_SIMD_SCALAR 1
+#include <cmath>
+#endif
+
+namespace parteeengine::simd {
+
+    // Four packed floats. Wraps SSE2 or NEON, with a scalar fallback so kernels
+    // written against it compile everywhere. Builds targeting AVX2 (-mavx2 -mfma)
+    // keep the four-wide type and use fused multiply-adds in mulAdd.
+    struct Float4 {
+#if defined(PARTEE_SIMD_SSE2)
+        __m128 v;
+#elif defined(PARTEE_SIMD_NEON)
+        float32x4_t v;
+#else
+        float v[4];
+#endif
+    };
+
+    // Per-lane comparison result; each lane is all ones or all zeros.
+    using Mask4 = Float4;
+
+    inline constexpr int Width = 4;
+
+#if defined(PARTEE_SIMD_SSE2)
+
+    inline Float4 load(const float* p) { return {_mm_loadu_ps(p)}; }
+    inline void store(float* p, Float4 a) { _mm_storeu_ps(p, a.v); }
+    // p must be 16-byte aligned.
+    inline Float4 loadAligned(const float* p) { return {_mm_load_ps(p)}; }
+    inline void storeAligned(float* p, Float4 a) { _mm_store_ps(p, a.v); }
+    inline Float4 set1(float s) { return {_mm_set1_ps(s)}; }
+    inline Float4 set(float x, float y, float z, float w) { return {_mm_setr_ps(x, y, z, w)}; }
+
+    inline Float4 operator+(Float4 a, Float4 b) { return {_mm_add_ps(a.v, b.v)}; }
+    inline Float4 operator-(Float4 a, Float4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+    inline Float4 operator*(Float4 a, Float4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+    inline Float4 operator/(Float4 a, Float4 b) { return {_mm_div_ps(a.v, b.v)}; }
+    // a * b + c, fused where the target has FMA.
+#if defined(PARTEE_SIMD_FMA)
+    inline Float4 mulAdd(Float4 a, Float4 b, Float4 c) { return {_mm_fmadd_ps(a.v, b.v, c.v)}; }
+#else
+    inline Float4 mulAdd(Float4 a, Float4 b, Float4 c) { return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)}; }
+#endif
+    // Every lane set to lane Lane of a.
+    template<int Lane>
+    inline Float4 splat(Float4 a) { return {_mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(Lane, Lane, Lane, Lane))}; }
+    inline Float4 min(Float4 a, Float4 b) { return {_mm_min_ps(a.v, b.v)}; }
+    inline Float4 max(Float4 a, Float4 b) { return {_mm_max_ps(a.v, b.v)}; }
+    inline Float4 sqrt(Float4 a) { return {_mm_sqrt_ps(a.v)}; }
+    inline Float4 abs(Float4 a) { return {_mm_andnot_ps(_mm_set1_ps(-0.f), a.v)}; }
+    // Rounds to the nearest integer (ties to even). Lanes must fit in an int32.
+    inline Float4 roundNearest(Float4 a) { return {_mm_cvtepi32_ps(_mm_cvtps_epi32(a.v))}; }
+
+    inline Mask4 operator<(Float4 a, Float4 b) { return {_mm_cmplt_ps(a.v, b.v)}; }
+    inline Mask4 operator<=(Float4 a, Float4 b) { return {_mm_cmple_ps(a.v, b.v)}; }
+    inline Mask4 operator>(Float4 a, Float4 b) { return {_mm_cmpgt_ps(a.v, b.v)}; }
+    inline Mask4 operator>=(Float4 a, Float4 b) { return {_mm_cmpge_ps(a.v, b.v)}; }
+    inline Mask4 operator&(Mask4 a, Mask4 b) { return {_mm_and_ps(a.v, b.v)}; }
+    inline Mask4 operator|(Mask4 a, Mask4 b) { return {_mm_or_ps(a.v, b.v)}; }
+
+    // Lane i of the result is b where mask is set, otherwise a.
+    inline Float4 select(Mask4 mask, Float4 a, Float4 b) {
+        return {_mm_or_ps(_mm_and_ps(mask.v, b.v), _mm_andnot_ps(mask.v, a.v))};
+    }
+    // Bit i is set when lane i of the mask is set.
+    inline int bitmask(Mask4 mask) { return _mm_movemask_ps(mask.v); }
+
+#elif defined(PARTEE_SIMD_NEON)
+
+    inline Float4 load(const float* p) { return {vld1q_f32(p)}; }
+    inline void store(float* p, Float4 a) { vst1q_f32(p, a.v); }
+    inline Float4 loadAligned(const float* p) { return {vld1q_f32(p)}; }
+    inline void storeAligned(float* p, Float4 a) { vst1q_f32(p, a.v); }
+    inline Float4 set1(float s) { return {vdupq_n_f32(s)}; }
+    inline Float4 set(float x, float y, float z, float w) { float t[4] = {x, y, z, w}; return {vld1q_f32(t)}; }
+
+    inline Float4 operator+(Float4 a, Float4 b) { return {vaddq_f32(a.v, b.v)}; }
+    inline Float4 operator-(Float4 a, Float4 b) { return {vsubq_f32(a.v, b.v)}; }
+    inline Float4 operator*(Float4 a, Float4 b) { return {vmulq_f32(a.v, b.v)}; }
+    inline Float4 operator/(Float4 a, Float4 b) { return {vdivq_f32(a.v, b.v)}; }
+    inline Float4 mulAdd(Float4 a, Float4 b, Float4 c) { return {vfmaq_f32(c.v, a.v, b.v)}; }
+    template<int Lane>
+    inline Float4 splat(Float4 a) { return {vdupq_laneq_f32(a.v, Lane)}; }
+    inline Float4 min(Float4 a, Float4 b) { return {vminq_f32(a.v, b.v)}; }
+    inline Float4 max(Float4 a, Float4 b) { return {vmaxq_f32(a.v, b.v)}; }
+    inline Float4 sqrt(Float4 a) { return {vsqrtq_f32(a.v)}; }
+    inline Float4 abs(Float4 a) { return {vabsq_f32(a.v)}; }
+    inline Float4 roundNearest(Float4 a) { return {vrndnq_f32(a.v)}; }
+
+    inline Mask4 operator<(Float4 a, Float4 b) { return {vreinterpretq_f32_u32(vcltq_f32(a.v, b.v))}; }
+    inline Mask4 operator<=(Float4 a, Float4 b) { return {vreinterpretq_f32_u32(vcleq_f32(a.v, b.v))}; }
+    inline Mask4 operator>(Float4 a, Float4 b) { return {vreinterpretq_f32_u32(vcgtq_f32(a.v, b.v))}; }
+    inline Mask4 operator>=(Float4 a, Float4 b) { return {vreinterpretq_f32_u32(vcgeq_f32(a.v, b.v))}; }
+    inline Mask4 operator&(Mask4 a, Mask4 b) {
+        return {vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+    }
+    inline Mask4 operator|(Mask4 a, Mask4 b) {
+        return {vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a.v), vreinterpretq_u32_f32(b.v)))};
+    }
+
+    inline Float4 select(Mask4 mask, Float4 a, Float4 b) { return {vbslq_f32(vreinterpretq_u32_f32(mask.v), b.v, a.v)}; }
+    inline int bitmask(Mask4 mask) {
+        uint32_t lanes[4];
+        vst1q_u32(lanes, vreinterpretq_u32_f32(mask.v));
+        return static_cast<int>((lanes[0] & 1) | (lanes[1] & 2) | (lanes[2] & 4) | (lanes[3] & 8));
+    }
+
+#else
+
+    inline Float4 load(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+    inline void store(float* p, Float4 a) { for (int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+    inline Float4 loadAligned(const float* p) { return load(p); }
+    inline void storeAligned(float* p, Float4 a) { store(p, a); }
+    inline Float4 set1(float s) { return {{s, s, s, s}}; }
+    inline Float4 set(float x, float y, float z, float w) { return {{x, y, z, w}}; }
+
+    template<typename Op>
+    inline Float4 lanewise(Float4 a, Float4 b, Op op) {
+        return {{op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3])}};
+    }
+    // Scalar masks use -1 for set lanes and 0 for clear ones; only bitmask, select and &/| read them.
+    inline float maskLane(bool set) { return set ? -1.f : 0.f; }
+
+    inline Float4 operator+(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return x + y; }); }
+    inline Float4 operator-(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return x - y; }); }
+    inline Float4 operator*(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return x * y; }); }
+    inline Float4 operator/(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return x / y; }); }
+    inline Float4 mulAdd(Float4 a, Float4 b, Float4 c) { return a * b + c; }
+    template<int Lane>
+    inline Float4 splat(Float4 a) { return set1(a.v[Lane]); }
+    inline Float4 min(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return y < x ? y : x; }); }
+    inline Float4 max(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return x < y ? y : x; }); }
+    inline Float4 sqrt(Float4 a) { return {{std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3])}}; }
+    inline Float4 abs(Float4 a) { return {{std::fabs(a.v[0]), std::fabs(a.v[1]), std::fabs(a.v[2]), std::fabs(a.v[3])}}; }
+    inline Float4 roundNearest(Float4 a) { return {{std::nearbyint(a.v[0]), std::nearbyint(a.v[1]), std::nearbyint(a.v[2]), std::nearbyint(a.v[3])}}; }
+
+    inline Mask4 operator<(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return maskLane(x < y); }); }
+    inline Mask4 operator<=(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return maskLane(x <= y); }); }
+    inline Mask4 operator>(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return maskLane(x > y); }); }
+    inline Mask4 operator>=(Float4 a, Float4 b) { return lanewise(a, b, [](float x, float y) { return maskLane(x >= y); }); }
+    inline Mask4 operator&(Mask4 a, Mask4 b) { return lanewise(a, b, [](float x, float y) { return maskLane(x != 0.f && y != 0.f); }); }
+    inline Mask4 operator|(Mask4 a, Mask4 b) { return lanewise(a, b, [](float x, float y) { return maskLane(x != 0.f || y != 0.f); }); }
+
+    inline Float4 select(Mask4 mask, Float4 a, Float4 b) {
+        return {{mask.v[0] != 0.f ? b.v[0] : a.v[0], mask.v[1] != 0.f ? b.v[1] : a.v[1],
+                 mask.v[2] != 0.f ? b.v[2] : a.v[2], mask.v[3] != 0.f ? b.v[3] : a.v[3]}};
+    }
+    inline int bitmask(Mask4 mask) {
+        return (mask.v[0] != 0.f ? 1 : 0) | (mask.v[1] != 0.f ? 2 : 0) | (mask.v[2] != 0.f ? 4 : 0) | (mask.v[3] != 0.f ? 8 : 0);
+    }
+
+#endif
+
+    // Sine and cosine of radian angles, about 1e-7 absolute error for |x| < 8192.
+    // Reduces to [-pi/4, pi/4] by quadrant, then evaluates the Cephes minimax polynomials.
+    inline void sinCos(Float4 x, Float4& sinOut, Float4& cosOut) {
+        Float4 quadrant = roundNearest(x * set1(0.63661977236758134f)); // x / (pi / 2)
+        // Three-part pi / 2 keeps the reduction exact for large quadrant numbers
+        Float4 r = x - quadrant * set1(1.5703125f);
+        r = r - quadrant * set1(4.837512969970703125e-4f);
+        r = r - quadrant * set1(7.54978995489188216e-8f);
+
+        Float4 r2 = r * r;
+        Float4 s = r + r * r2 * (set1(-1.6666654611e-1f) + r2 * (set1(8.3321608736e-3f) + r2 * set1(-1.9515295891e-4f)));
+        Float4 c = set1(1.f) - set1(0.5f) * r2
+            + r2 * r2 * (set1(4.166664568298827e-2f) + r2 * (set1(-1.388731625493765e-3f) + r2 * set1(2.443315711809948e-5f)));
+
+        // quadrant mod 4, as a float in {0, 1, 2, 3}
+        Float4 m = quadrant - set1(4.f) * roundNearest(quadrant * set1(0.25f) - set1(0.375f));
+        Float4 distanceFromTwo = abs(m - set1(2.f));
+        Mask4 odd = (distanceFromTwo > set1(0.5f)) & (distanceFromTwo < set1(1.5f));
+        Mask4 sinNegative = m > set1(1.5f);
+        Mask4 cosNegative = abs(m - set1(1.5f)) < set1(1.f);
+
+        Float4 sinValue = select(odd, s, c);
+        Float4 cosValue = select(odd, c, s);
+        Float4 zero = set1(0.f);
+        sinOut = select(sinNegative, sinValue, zero - sinValue);
+        cosOut = select(cosNegative, cosValue, zero - cosValue);
+    }
+
+} // namespace parteeengine::simd
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <typeindex>
+
+namespace parteeengine {
+
+    // type's name for people: demangled where the compiler mangles type_info::name(),
+    // without namespaces or "struct "/"class ", e.g. "QuadRenderCommand". Each type's
+    // name is built once; the pointer stays valid for the life of the process, so it
+    // can name profiler zones. Thread-safe.
+    const char* readableTypeName(std::type_index type);
+
+} // namespace parteeengine
@@ -60,13 +60,12 @@ namespace parteeengine {
         }
         
         float length() const {
-            return sqrt(x * x + y * y + z * z);
+            return std::sqrt(x * x + y * y + z * z);
         }
         
+        // Same as normalized(); zero stays zero.
         Vector3 normalize() const {
-            float len = length();
-            if (len == 0) return Vector3(0, 0, 0);
-            return *this / len;
+            return normalized();
         }
 
         Vector3 normalized() const {
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "engine/util/Simd.hpp"
+#include "engine/util/Vector3.hpp"
+
+#include <cmath>
+
+namespace parteeengine {
+
+    // 4D vector aligned to 16 bytes, so it loads as one SIMD register. The
+    // element-wise operators run on simd::Float4; Mat3 and Mat4 keep their
+    // columns in it.
+    struct alignas(16) Vector4 {
+        float x, y, z, w;
+
+        Vector4(float x_ = 0, float y_ = 0, float z_ = 0, float w_ = 0) : x(x_), y(y_), z(z_), w(w_) {}
+        Vector4(const Vector3& v, float w_) : x(v.x), y(v.y), z(v.z), w(w_) {}
+
+        static Vector4 fromSimd(simd::Float4 v) {
+            Vector4 result;
+            simd::storeAligned(&result.x, v);
+            return result;
+        }
+        simd::Float4 toSimd() const { return simd::loadAligned(&x); }
+
+        Vector4 operator+(const Vector4& other) const { return fromSimd(toSimd() + other.toSimd()); }
+        Vector4 operator-(const Vector4& other) const { return fromSimd(toSimd() - other.toSimd()); }
+        Vector4 operator*(float scalar) const { return fromSimd(toSimd() * simd::set1(scalar)); }
+        Vector4 operator/(float scalar) const { return fromSimd(toSimd() / simd::set1(scalar)); }
+        Vector4 operator-() const { return fromSimd(simd::set1(0.f) - toSimd()); }
+
+        Vector4& operator+=(const Vector4& other) { return *this = *this + other; }
+        Vector4& operator-=(const Vector4& other) { return *this = *this - other; }
+        Vector4& operator*=(float scalar) { return *this = *this * scalar; }
+        Vector4& operator/=(float scalar) { return *this = *this / scalar; }
+
+        // Component-wise multiplication
+        Vector4 componentMul(const Vector4& other) const { return fromSimd(toSimd() * other.toSimd()); }
+
+        float dot(const Vector4& other) const {
+            return x * other.x + y * other.y + z * other.z + w * other.w;
+        }
+
+        float lengthSquared() const { return dot(*this); }
+        float length() const { return std::sqrt(lengthSquared()); }
+
+        // Zero stays zero.
+        Vector4 normalized() const {
+            float len = length();
+            if (len == 0) return Vector4(0, 0, 0, 0);
+            return *this / len;
+        }
+
+        Vector3 xyz() const { return Vector3(x, y, z); }
+    };
+
+    // Scalar * Vector4
+    inline Vector4 operator*(float scalar, const Vector4& v) {
+        return v * scalar;
+    }
+
+} // namespace parteeengine
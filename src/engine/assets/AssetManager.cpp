@@ -0,0 +1,217 @@
+#include "engine/assets/AssetManager.hpp"
+
+#include "engine/core/events/EventBus.hpp"
+#include "engine/core/metrics/Metrics.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace parteeengine::assets {
+
+    namespace detail {
+
+        void AssetStore::acquireLocked(AssetSlot* slot) {
+            slot->refCount.fetch_add(1, std::memory_order_relaxed);
+            if (slot->inLru) {
+                lru.erase(slot->lruPosition);
+                slot->inLru = false;
+            }
+        }
+
+        void AssetStore::release(AssetSlot* slot) {
+            // Other handles keep the slot alive, so dropping one of several needs no lock
+            uint32_t count = slot->refCount.load(std::memory_order_relaxed);
+            while (count > 1) {
+                if (slot->refCount.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    return;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            // A concurrent copy or load() may have added a reference since
+            if (slot->refCount.fetch_sub(1, std::memory_order_acq_rel) != 1 || slot->inLru) {
+                return;
+            }
+            AssetState state = slot->state.load(std::memory_order_acquire);
+            if (state == AssetState::Failed) {
+                // Nothing to keep; the next request retries the load
+                slots.erase(Key{slot->type, slot->path});
+                return;
+            }
+            if (state != AssetState::Ready) {
+                return; // load() files it once it finishes
+            }
+            lru.push_front(slot);
+            slot->lruPosition = lru.begin();
+            slot->inLru = true;
+            evictLocked(memoryBudget);
+        }
+
+        void AssetStore::wait(AssetSlot* slot) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (slot->state.load(std::memory_order_acquire) == AssetState::Queued) {
+                // Nobody has started on it; loading here beats waiting behind the rest of the queue
+                auto it = std::find(queue.begin(), queue.end(), slot);
+                if (it != queue.end()) {
+                    queue.erase(it);
+                    slot->state.store(AssetState::Loading, std::memory_order_release);
+                    lock.unlock();
+                    load(slot);
+                    return;
+                }
+            }
+            loadFinished.wait(lock, [slot] {
+                AssetState state = slot->state.load(std::memory_order_acquire);
+                return state == AssetState::Ready || state == AssetState::Failed;
+            });
+        }
+
+        void AssetStore::load(AssetSlot* slot) {
+            PARTEE_PROFILE_ZONE("AssetManager::load");
+            bool success = false;
+            FileData file;
+            if (!fileSystem.read(slot->path, file)) {
+                slot->error = "File not found: " + slot->path;
+            } else {
+                // Uncompressed packed files decode straight from the mapping
+                try {
+                    slot->decode(file.contents());
+                    success = true;
+                } catch (const std::exception& e) {
+                    slot->error = e.what();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            slot->state.store(success ? AssetState::Ready : AssetState::Failed, std::memory_order_release);
+            completed.push_back(AssetLoadedEvent{slot->path, slot->type, success});
+            if (success) {
+                usedBytes += slot->bytes;
+            }
+            if (slot->refCount.load(std::memory_order_acquire) == 0) {
+                // Every handle went away while it was loading
+                if (success) {
+                    lru.push_front(slot);
+                    slot->lruPosition = lru.begin();
+                    slot->inLru = true;
+                } else {
+                    slots.erase(Key{slot->type, slot->path});
+                }
+            }
+            evictLocked(memoryBudget);
+            loadFinished.notify_all();
+        }
+
+        void AssetStore::evictLocked(size_t budget) {
+            while (usedBytes > budget && !lru.empty()) {
+                AssetSlot* victim = lru.back();
+                lru.pop_back();
+                usedBytes -= victim->bytes;
+                slots.erase(Key{victim->type, victim->path});
+            }
+        }
+
+    } // namespace detail
+
+    AssetManager::AssetManager(size_t loaderThreads) : store(std::make_shared<detail::AssetStore>()) {
+        store->memoryBudget = DefaultMemoryBudget;
+        loaderThreads = std::max<size_t>(loaderThreads, 1);
+        loaders.reserve(loaderThreads);
+        for (size_t i = 0; i < loaderThreads; ++i) {
+            loaders.emplace_back([this] { loaderLoop(); });
+        }
+    }
+
+    AssetManager::~AssetManager() {
+        {
+            std::lock_guard<std::mutex> lock(store->mutex);
+            store->stopping = true;
+        }
+        store->workReady.notify_all();
+        for (auto& loader : loaders) {
+            loader.join();
+        }
+
+        // Fail whatever never started so waiting handles don't hang
+        std::lock_guard<std::mutex> lock(store->mutex);
+        for (detail::AssetSlot* slot : store->queue) {
+            slot->error = "Asset manager shut down before loading " + slot->path;
+            slot->state.store(AssetState::Failed, std::memory_order_release);
+        }
+        store->queue.clear();
+        store->loadFinished.notify_all();
+    }
+
+    void AssetManager::loaderLoop() {
+        while (true) {
+            detail::AssetSlot* slot;
+            {
+                std::unique_lock<std::mutex> lock(store->mutex);
+                store->workReady.wait(lock, [this] { return store->stopping || !store->queue.empty(); });
+                if (store->stopping) {
+                    return;
+                }
+                slot = store->queue.front();
+                store->queue.pop_front();
+                slot->state.store(AssetState::Loading, std::memory_order_release);
+            }
+            store->load(slot);
+        }
+    }
+
+    void AssetManager::update(events::EventBus* events) {
+        std::vector<AssetLoadedEvent> finished;
+        size_t usedBytes, assetCount;
+        {
+            std::lock_guard<std::mutex> lock(store->mutex);
+            finished.swap(store->completed);
+            usedBytes = store->usedBytes;
+            assetCount = store->slots.size();
+        }
+        if (events) {
+            for (const auto& event : finished) {
+                events->publish(event);
+            }
+        }
+        metrics::Metrics::setGauge(metrics::names::AssetMemory, static_cast<double>(usedBytes));
+        metrics::Metrics::setGauge(metrics::names::AssetCount, static_cast<double>(assetCount));
+    }
+
+    AssetManager& AssetManager::setMemoryBudget(size_t bytes) {
+        std::lock_guard<std::mutex> lock(store->mutex);
+        store->memoryBudget = bytes;
+        store->evictLocked(bytes);
+        return *this;
+    }
+
+    size_t AssetManager::getMemoryBudget() const {
+        std::lock_guard<std::mutex> lock(store->mutex);
+        return store->memoryBudget;
+    }
+
+    size_t AssetManager::getMemoryUsage() const {
+        std::lock_guard<std::mutex> lock(store->mutex);
+        return store->usedBytes;
+    }
+
+    size_t AssetManager::getAssetCount() const {
+        std::lock_guard<std::mutex> lock(store->mutex);
+        return store->slots.size();
+    }
+
+    void AssetManager::trim() {
+        std::lock_guard<std::mutex> lock(store->mutex);
+        // Referenced assets are not in the LRU list and stay
+        for (detail::AssetSlot* victim : store->lru) {
+            store->usedBytes -= victim->bytes;
+            store->slots.erase(detail::AssetStore::Key{victim->type, victim->path});
+        }
+        store->lru.clear();
+    }
+
+    bool AssetManager::mount(const std::filesystem::path& packPath) {
+        return store->fileSystem.mount(packPath);
+    }
+
+} // namespace parteeengine::assets
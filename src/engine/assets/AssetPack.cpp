@@ -0,0 +1,234 @@
+#include "engine/assets/AssetPack.hpp"
+
+#include "engine/util/Lz4.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace parteeengine::assets {
+
+    namespace pack {
+
+        // Skips a leading "./" (or ".\")
+        static std::string_view stripDotSlash(std::string_view path) {
+            while (path.size() >= 2 && path[0] == '.' && (path[1] == '/' || path[1] == '\\')) {
+                path.remove_prefix(2);
+            }
+            return path;
+        }
+
+        uint64_t hashPath(std::string_view path) {
+            uint64_t hash = 14695981039346656037ull;
+            for (char c : stripDotSlash(path)) {
+                hash ^= static_cast<uint8_t>(c == '\\' ? '/' : c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        bool pathEquals(std::string_view normalized, std::string_view path) {
+            path = stripDotSlash(path);
+            if (normalized.size() != path.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < path.size(); ++i) {
+                if (normalized[i] != (path[i] == '\\' ? '/' : path[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::string normalizePath(std::string_view path) {
+            std::string result(stripDotSlash(path));
+            std::replace(result.begin(), result.end(), '\\', '/');
+            return result;
+        }
+
+    } // namespace pack
+
+    bool AssetPack::open(const std::filesystem::path& path) {
+        entries = {};
+        paths = {};
+        if (!file.open(path)) {
+            return false;
+        }
+        filePath = path;
+
+        auto fail = [this] {
+            file.close();
+            entries = {};
+            paths = {};
+            return false;
+        };
+
+        const uint64_t fileSize = file.size();
+        if (fileSize < sizeof(pack::PackHeader)) {
+            return fail();
+        }
+        pack::PackHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (std::memcmp(header.magic, pack::Magic, sizeof(header.magic)) != 0 || header.version != pack::Version) {
+            return fail();
+        }
+        if (header.indexOffset % alignof(pack::PackEntry) != 0 || header.indexOffset > fileSize
+            || header.entryCount > (fileSize - header.indexOffset) / sizeof(pack::PackEntry)
+            || header.pathsOffset > fileSize || header.pathsSize > fileSize - header.pathsOffset) {
+            return fail();
+        }
+
+        // The mapping is page aligned and indexOffset entry aligned, so the index is used in place
+        entries = {reinterpret_cast<const pack::PackEntry*>(file.data() + header.indexOffset), static_cast<size_t>(header.entryCount)};
+        paths = {file.data() + header.pathsOffset, static_cast<size_t>(header.pathsSize)};
+        for (const auto& entry : entries) {
+            if (entry.offset > fileSize || entry.storedSize > fileSize - entry.offset
+                || static_cast<uint64_t>(entry.pathOffset) + entry.pathLength > paths.size()) {
+                return fail();
+            }
+        }
+        return true;
+    }
+
+    const pack::PackEntry* AssetPack::find(std::string_view path) const {
+        uint64_t hash = pack::hashPath(path);
+        auto it = std::lower_bound(entries.begin(), entries.end(), hash,
+            [](const pack::PackEntry& entry, uint64_t value) { return entry.pathHash < value; });
+        // Hash collisions are adjacent in the sorted index
+        for (; it != entries.end() && it->pathHash == hash; ++it) {
+            if (pack::pathEquals(getPath(*it), path)) {
+                return &*it;
+            }
+        }
+        return nullptr;
+    }
+
+    std::string_view AssetPack::stored(const pack::PackEntry& entry) const {
+        return {file.data() + entry.offset, static_cast<size_t>(entry.storedSize)};
+    }
+
+    bool AssetPack::read(const pack::PackEntry& entry, std::string& out) const {
+        std::string_view data = stored(entry);
+        if (!(entry.flags & pack::EntryCompressed)) {
+            out.assign(data);
+            return true;
+        }
+        out.resize(static_cast<size_t>(entry.originalSize));
+        return lz4::decompress(reinterpret_cast<const uint8_t*>(data.data()), data.size(),
+            reinterpret_cast<uint8_t*>(out.data()), out.size());
+    }
+
+    std::string_view AssetPack::getPath(const pack::PackEntry& entry) const {
+        return paths.substr(entry.pathOffset, entry.pathLength);
+    }
+
+    void AssetPackWriter::add(std::string_view packPath, std::string contents) {
+        std::string path = pack::normalizePath(packPath);
+        for (auto& file : files) {
+            if (file.path == path) {
+                file.contents = std::move(contents);
+                return;
+            }
+        }
+        files.push_back({std::move(path), std::move(contents)});
+    }
+
+    size_t AssetPackWriter::addDirectory(const std::filesystem::path& directory, const std::filesystem::path& base) {
+        std::vector<std::filesystem::path> found;
+        std::error_code error;
+        for (auto it = std::filesystem::recursive_directory_iterator(directory, error);
+             !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+            if (it->is_regular_file(error)) {
+                found.push_back(it->path());
+            }
+        }
+        // Directory iteration order is unspecified; sort so packs build reproducibly
+        std::sort(found.begin(), found.end());
+
+        size_t added = 0;
+        for (const auto& path : found) {
+            std::ifstream input(path, std::ios::binary);
+            if (!input.is_open()) {
+                continue;
+            }
+            std::string contents((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+            add(std::filesystem::relative(path, base, error).generic_string(), std::move(contents));
+            ++added;
+        }
+        return added;
+    }
+
+    AssetPackWriter& AssetPackWriter::setCompression(bool enabled, float minSavings) {
+        compress = enabled;
+        this->minSavings = minSavings;
+        return *this;
+    }
+
+    bool AssetPackWriter::write(const std::filesystem::path& outputPath) const {
+        std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            return false;
+        }
+
+        auto pad = [&output](uint64_t& offset, uint64_t alignment) {
+            static const char zeros[pack::EntryAlignment] = {};
+            uint64_t padding = (alignment - offset % alignment) % alignment;
+            output.write(zeros, static_cast<std::streamsize>(padding));
+            offset += padding;
+        };
+
+        pack::PackHeader header{};
+        std::memcpy(header.magic, pack::Magic, sizeof(header.magic));
+        header.version = pack::Version;
+        header.entryCount = files.size();
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header)); // Rewritten once offsets are known
+        uint64_t offset = sizeof(header);
+
+        std::vector<pack::PackEntry> index;
+        index.reserve(files.size());
+        std::string paths;
+        std::vector<uint8_t> compressed;
+        for (const auto& file : files) {
+            pad(offset, pack::EntryAlignment);
+
+            pack::PackEntry entry{};
+            entry.pathHash = pack::hashPath(file.path);
+            entry.offset = offset;
+            entry.originalSize = file.contents.size();
+            entry.pathOffset = static_cast<uint32_t>(paths.size());
+            entry.pathLength = static_cast<uint32_t>(file.path.size());
+            paths += file.path;
+
+            const char* data = file.contents.data();
+            uint64_t size = file.contents.size();
+            if (compress && !file.contents.empty()) {
+                compressed.clear();
+                lz4::compress(reinterpret_cast<const uint8_t*>(file.contents.data()), file.contents.size(), compressed);
+                if (static_cast<double>(compressed.size()) <= static_cast<double>(file.contents.size()) * (1.0 - minSavings)) {
+                    data = reinterpret_cast<const char*>(compressed.data());
+                    size = compressed.size();
+                    entry.flags |= pack::EntryCompressed;
+                }
+            }
+            entry.storedSize = size;
+            output.write(data, static_cast<std::streamsize>(size));
+            offset += size;
+            index.push_back(entry);
+        }
+
+        std::sort(index.begin(), index.end(), [](const pack::PackEntry& a, const pack::PackEntry& b) { return a.pathHash < b.pathHash; });
+        pad(offset, pack::EntryAlignment);
+        header.indexOffset = offset;
+        output.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(pack::PackEntry)));
+        offset += index.size() * sizeof(pack::PackEntry);
+
+        header.pathsOffset = offset;
+        header.pathsSize = paths.size();
+        output.write(paths.data(), static_cast<std::streamsize>(paths.size()));
+
+        output.seekp(0);
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        return output.good();
+    }
+
+} // namespace parteeengine::assets
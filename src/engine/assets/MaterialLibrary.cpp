@@ -0,0 +1,90 @@
+#include "engine/assets/MaterialLibrary.hpp"
+
+#include "engine/assets/TextScanner.hpp"
+
+#include <stdexcept>
+
+namespace parteeengine::assets {
+
+    std::unique_ptr<MaterialLibrary> MaterialLibrary::decode(std::string_view bytes, const std::string& path) {
+        auto library = std::make_unique<MaterialLibrary>();
+        TextScanner scanner(bytes);
+
+        auto fail = [&](const std::string& message) {
+            throw std::runtime_error(path + ":" + std::to_string(scanner.getLineNumber()) + ": " + message);
+        };
+
+        while (scanner.nextLine()) {
+            std::string_view keyword = scanner.token();
+            if (keyword.empty() || keyword[0] == '#') {
+                continue;
+            }
+
+            if (keyword == "newmtl") {
+                Material material;
+                // Names and Windows paths may contain spaces, so they take the rest of the line
+                material.name = scanner.rest();
+                library->materials.push_back(std::move(material));
+                continue;
+            }
+            if (library->materials.empty()) {
+                fail("'" + std::string(keyword) + "' before any newmtl");
+            }
+            Material& material = library->materials.back();
+
+            auto readFloat = [&](float& out) {
+                if (!scanner.readFloat(out)) fail("Expected a number after '" + std::string(keyword) + "'");
+            };
+            auto readColor = [&](Vector3& out) {
+                readFloat(out.x);
+                // A single value means a grey colour
+                if (!scanner.readFloat(out.y)) {
+                    out.y = out.z = out.x;
+                } else {
+                    readFloat(out.z);
+                }
+            };
+
+            if (keyword == "Ka") readColor(material.ambient);
+            else if (keyword == "Kd") readColor(material.diffuse);
+            else if (keyword == "Ks") readColor(material.specular);
+            else if (keyword == "Ke") readColor(material.emissive);
+            else if (keyword == "Ns") readFloat(material.shininess);
+            else if (keyword == "Ni") readFloat(material.refractiveIndex);
+            else if (keyword == "d") readFloat(material.opacity);
+            else if (keyword == "Tr") {
+                float transparency;
+                readFloat(transparency);
+                material.opacity = 1.f - transparency;
+            }
+            else if (keyword == "Pr") readFloat(material.roughness);
+            else if (keyword == "illum") {
+                if (!scanner.readInt(material.illuminationModel)) fail("Expected an integer after 'illum'");
+            }
+            else if (keyword == "map_Ka") material.ambientMap = scanner.rest();
+            else if (keyword == "map_Kd") material.diffuseMap = scanner.rest();
+            else if (keyword == "map_bump" || keyword == "bump") material.bumpMap = scanner.rest();
+        }
+
+        return library;
+    }
+
+    const Material* MaterialLibrary::find(std::string_view name) const {
+        for (const auto& material : materials) {
+            if (material.name == name) {
+                return &material;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t MaterialLibrary::memoryUsage() const {
+        size_t bytes = sizeof(MaterialLibrary) + materials.capacity() * sizeof(Material);
+        for (const auto& material : materials) {
+            bytes += material.name.capacity() + material.ambientMap.capacity()
+                + material.diffuseMap.capacity() + material.bumpMap.capacity();
+        }
+        return bytes;
+    }
+
+} // namespace parteeengine::assets
@@ -0,0 +1,399 @@
+#include "engine/assets/Mesh.hpp"
+
+#include "engine/assets/TextScanner.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace parteeengine::assets {
+
+    namespace {
+
+        constexpr uint64_t SectionAlignment = 16;
+
+        // Open-addressing map from an OBJ position/uv/normal index triple to the
+        // mesh vertex it produced. Linear probing over a power-of-two table.
+        class VertexDedupTable {
+        public:
+            explicit VertexDedupTable(size_t expected) {
+                size_t capacity = 64;
+                while (capacity < expected * 2) capacity <<= 1;
+                slots.assign(capacity, Slot{});
+            }
+
+            // Returns the existing vertex for the key, or stores and returns newIndex.
+            uint32_t findOrInsert(int32_t position, int32_t uv, int32_t normal, uint32_t newIndex, bool& inserted) {
+                if ((count + 1) * 2 > slots.size()) {
+                    grow();
+                }
+                size_t mask = slots.size() - 1;
+                for (size_t i = hash(position, uv, normal) & mask;; i = (i + 1) & mask) {
+                    Slot& slot = slots[i];
+                    if (slot.vertex == Empty) {
+                        slot = {position, uv, normal, newIndex};
+                        ++count;
+                        inserted = true;
+                        return newIndex;
+                    }
+                    if (slot.position == position && slot.uv == uv && slot.normal == normal) {
+                        inserted = false;
+                        return slot.vertex;
+                    }
+                }
+            }
+
+        private:
+            static constexpr uint32_t Empty = std::numeric_limits<uint32_t>::max();
+
+            struct Slot {
+                int32_t position = 0;
+                int32_t uv = 0;
+                int32_t normal = 0;
+                uint32_t vertex = Empty;
+            };
+
+            static size_t hash(int32_t position, int32_t uv, int32_t normal) {
+                uint64_t h = static_cast<uint32_t>(position) * 0x9E3779B97F4A7C15ull;
+                h ^= (static_cast<uint32_t>(uv) + 0x7F4A7C15ull + (h << 6) + (h >> 2)) * 0xBF58476D1CE4E5B9ull;
+                h ^= (static_cast<uint32_t>(normal) + 0x94D049BBull + (h << 6) + (h >> 2)) * 0x94D049BB133111EBull;
+                return static_cast<size_t>(h ^ (h >> 31));
+            }
+
+            void grow() {
+                std::vector<Slot> old(slots.size() * 2, Slot{});
+                old.swap(slots);
+                size_t mask = slots.size() - 1;
+                for (const Slot& slot : old) {
+                    if (slot.vertex == Empty) continue;
+                    size_t i = hash(slot.position, slot.uv, slot.normal) & mask;
+                    while (slots[i].vertex != Empty) i = (i + 1) & mask;
+                    slots[i] = slot;
+                }
+            }
+
+            std::vector<Slot> slots;
+            size_t count = 0;
+        };
+
+        uint64_t alignUp(uint64_t value) {
+            return (value + SectionAlignment - 1) & ~(SectionAlignment - 1);
+        }
+
+        void computeBounds(Mesh& mesh) {
+            if (mesh.vertices.empty()) {
+                return;
+            }
+            for (int axis = 0; axis < 3; ++axis) {
+                mesh.boundsMin[axis] = std::numeric_limits<float>::max();
+                mesh.boundsMax[axis] = std::numeric_limits<float>::lowest();
+            }
+            for (const auto& vertex : mesh.vertices) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    mesh.boundsMin[axis] = std::min(mesh.boundsMin[axis], vertex.position[axis]);
+                    mesh.boundsMax[axis] = std::max(mesh.boundsMax[axis], vertex.position[axis]);
+                }
+            }
+        }
+
+    } // namespace
+
+    std::unique_ptr<Mesh> Mesh::decode(std::string_view bytes, const std::string& path) {
+        if (bytes.size() >= sizeof(MeshCache::Magic) && std::memcmp(bytes.data(), MeshCache::Magic, sizeof(MeshCache::Magic)) == 0) {
+            MeshCache cache;
+            if (!cache.view(bytes)) {
+                throw std::runtime_error(path + ": corrupt or misaligned mesh cache");
+            }
+            return cache.toMesh();
+        }
+        return parseObj(bytes, path);
+    }
+
+    std::unique_ptr<Mesh> Mesh::parseObj(std::string_view text, const std::string& path) {
+        auto mesh = std::make_unique<Mesh>();
+        TextScanner scanner(text);
+
+        auto fail = [&](const std::string& message) {
+            throw std::runtime_error(path + ":" + std::to_string(scanner.getLineNumber()) + ": " + message);
+        };
+
+        // Rough per-line byte counts of typical exporters, to avoid most regrowth
+        std::vector<float> positions, uvs, normals;
+        positions.reserve(text.size() / 12);
+        mesh->vertices.reserve(text.size() / 40);
+        mesh->indices.reserve(text.size() / 10);
+        VertexDedupTable dedup(text.size() / 40);
+
+        mesh->submeshes.emplace_back();
+        std::vector<uint32_t> polygon;
+
+        // OBJ indices are 1-based, or negative to count back from the latest element
+        auto resolve = [&](int index, size_t count, const char* kind) -> int32_t {
+            int64_t resolved = index > 0 ? int64_t(index) - 1 : int64_t(count) + index;
+            if (index == 0 || resolved < 0 || resolved >= static_cast<int64_t>(count)) {
+                fail(std::string("Face references a missing ") + kind);
+            }
+            return static_cast<int32_t>(resolved);
+        };
+
+        auto readCorner = [&](std::string_view corner) -> uint32_t {
+            auto readIndex = [&](std::string_view& rest, int& out) {
+                auto [end, error] = std::from_chars(rest.data(), rest.data() + rest.size(), out);
+                if (error != std::errc()) fail("Malformed face index '" + std::string(corner) + "'");
+                rest.remove_prefix(static_cast<size_t>(end - rest.data()));
+            };
+
+            std::string_view rest = corner;
+            int positionIndex = 0, uvIndex = 0, normalIndex = 0;
+            readIndex(rest, positionIndex);
+            if (!rest.empty() && rest[0] == '/') {
+                rest.remove_prefix(1);
+                if (!rest.empty() && rest[0] != '/') readIndex(rest, uvIndex);
+                if (!rest.empty() && rest[0] == '/') {
+                    rest.remove_prefix(1);
+                    readIndex(rest, normalIndex);
+                }
+            }
+            if (!rest.empty()) fail("Malformed face index '" + std::string(corner) + "'");
+
+            int32_t position = resolve(positionIndex, positions.size() / 3, "position");
+            int32_t uv = uvIndex != 0 ? resolve(uvIndex, uvs.size() / 2, "texture coordinate") : -1;
+            int32_t normal = normalIndex != 0 ? resolve(normalIndex, normals.size() / 3, "normal") : -1;
+
+            bool inserted;
+            uint32_t vertexIndex = dedup.findOrInsert(position, uv, normal, static_cast<uint32_t>(mesh->vertices.size()), inserted);
+            if (inserted) {
+                MeshVertex vertex{};
+                std::memcpy(vertex.position, &positions[size_t(position) * 3], sizeof(vertex.position));
+                if (uv >= 0) std::memcpy(vertex.uv, &uvs[size_t(uv) * 2], sizeof(vertex.uv));
+                if (normal >= 0) std::memcpy(vertex.normal, &normals[size_t(normal) * 3], sizeof(vertex.normal));
+                mesh->vertices.push_back(vertex);
+            }
+            return vertexIndex;
+        };
+
+        auto readFloats = [&](std::vector<float>& out, int required, int optional) {
+            for (int i = 0; i < required; ++i) {
+                float value;
+                if (!scanner.readFloat(value)) fail("Expected a number");
+                out.push_back(value);
+            }
+            for (int i = 0; i < optional; ++i) {
+                float ignored;
+                scanner.readFloat(ignored); // e.g. the w of "v x y z w"
+            }
+        };
+
+        while (scanner.nextLine()) {
+            std::string_view keyword = scanner.token();
+            if (keyword.empty() || keyword[0] == '#') {
+                continue;
+            }
+
+            if (keyword == "v") {
+                readFloats(positions, 3, 1);
+            } else if (keyword == "vt") {
+                readFloats(uvs, 1, 0);
+                float v = 0.f;
+                scanner.readFloat(v); // The v coordinate is optional in the format
+                uvs.push_back(v);
+            } else if (keyword == "vn") {
+                readFloats(normals, 3, 0);
+            } else if (keyword == "f") {
+                polygon.clear();
+                for (std::string_view corner = scanner.token(); !corner.empty(); corner = scanner.token()) {
+                    polygon.push_back(readCorner(corner));
+                }
+                if (polygon.size() < 3) fail("Face with fewer than three vertices");
+                for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+                    mesh->indices.push_back(polygon[0]);
+                    mesh->indices.push_back(polygon[i]);
+                    mesh->indices.push_back(polygon[i + 1]);
+                }
+            } else if (keyword == "usemtl") {
+                Submesh* current = &mesh->submeshes.back();
+                uint32_t indexCount = static_cast<uint32_t>(mesh->indices.size());
+                if (indexCount > current->indexOffset) {
+                    current->indexCount = indexCount - current->indexOffset;
+                    current = &mesh->submeshes.emplace_back();
+                    current->indexOffset = indexCount;
+                }
+                current->material = scanner.rest();
+            } else if (keyword == "mtllib") {
+                mesh->materialLibrary = scanner.rest();
+            }
+            // o, g, s, l and other statements don't affect the mesh data
+        }
+
+        Submesh& last = mesh->submeshes.back();
+        last.indexCount = static_cast<uint32_t>(mesh->indices.size()) - last.indexOffset;
+        std::erase_if(mesh->submeshes, [](const Submesh& submesh) { return submesh.indexCount == 0; });
+
+        computeBounds(*mesh);
+        mesh->vertices.shrink_to_fit();
+        mesh->indices.shrink_to_fit();
+        return mesh;
+    }
+
+    size_t Mesh::memoryUsage() const {
+        size_t bytes = sizeof(Mesh) + vertices.capacity() * sizeof(MeshVertex) + indices.capacity() * sizeof(uint32_t)
+            + submeshes.capacity() * sizeof(Submesh) + materialLibrary.capacity();
+        for (const auto& submesh : submeshes) {
+            bytes += submesh.material.capacity();
+        }
+        return bytes;
+    }
+
+    bool MeshCache::write(const Mesh& mesh, const std::filesystem::path& cachePath, uint64_t sourceStamp) {
+        std::string strings = mesh.materialLibrary;
+        std::vector<SubmeshRecord> records;
+        records.reserve(mesh.submeshes.size());
+        for (const auto& submesh : mesh.submeshes) {
+            records.push_back({submesh.indexOffset, submesh.indexCount,
+                static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(submesh.material.size())});
+            strings += submesh.material;
+        }
+
+        Header header{};
+        std::memcpy(header.magic, Magic, sizeof(header.magic));
+        header.version = Version;
+        header.sourceStamp = sourceStamp;
+        header.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+        header.indexCount = static_cast<uint32_t>(mesh.indices.size());
+        header.submeshCount = static_cast<uint32_t>(records.size());
+        header.stringsSize = static_cast<uint32_t>(strings.size());
+        header.vertexOffset = alignUp(sizeof(Header));
+        header.indexOffset = alignUp(header.vertexOffset + mesh.vertices.size() * sizeof(MeshVertex));
+        header.submeshOffset = alignUp(header.indexOffset + mesh.indices.size() * sizeof(uint32_t));
+        header.stringsOffset = alignUp(header.submeshOffset + records.size() * sizeof(SubmeshRecord));
+        std::copy(std::begin(mesh.boundsMin), std::end(mesh.boundsMin), header.boundsMin);
+        std::copy(std::begin(mesh.boundsMax), std::end(mesh.boundsMax), header.boundsMax);
+
+        std::ofstream output(cachePath, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            return false;
+        }
+        uint64_t offset = 0;
+        auto writeAt = [&](uint64_t target, const void* data, size_t size) {
+            static const char zeros[SectionAlignment] = {};
+            output.write(zeros, static_cast<std::streamsize>(target - offset));
+            output.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            offset = target + size;
+        };
+        writeAt(0, &header, sizeof(header));
+        writeAt(header.vertexOffset, mesh.vertices.data(), mesh.vertices.size() * sizeof(MeshVertex));
+        writeAt(header.indexOffset, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+        writeAt(header.submeshOffset, records.data(), records.size() * sizeof(SubmeshRecord));
+        writeAt(header.stringsOffset, strings.data(), strings.size());
+        return output.good();
+    }
+
+    uint64_t MeshCache::stampFor(const std::filesystem::path& sourcePath) {
+        std::error_code error;
+        uint64_t size = std::filesystem::file_size(sourcePath, error);
+        if (error) return 0;
+        auto modified = std::filesystem::last_write_time(sourcePath, error);
+        if (error) return 0;
+        uint64_t ticks = static_cast<uint64_t>(modified.time_since_epoch().count());
+        return (size * 0x9E3779B97F4A7C15ull) ^ ticks ^ 1; // Never 0 for an existing file
+    }
+
+    std::unique_ptr<Mesh> MeshCache::loadObj(const std::filesystem::path& objPath, const std::filesystem::path& cachePath) {
+        uint64_t stamp = stampFor(objPath);
+        if (stamp == 0) {
+            return nullptr;
+        }
+        MeshCache cache;
+        if (cache.open(cachePath) && cache.getHeader().sourceStamp == stamp) {
+            return cache.toMesh();
+        }
+        cache = MeshCache();
+
+        // Parse straight out of a mapping of the text
+        MappedFile source;
+        if (!source.open(objPath)) {
+            return nullptr;
+        }
+        std::unique_ptr<Mesh> mesh = Mesh::parseObj(source.view(), objPath.string());
+        write(*mesh, cachePath, stamp); // A failed write only costs the next load a parse
+        return mesh;
+    }
+
+    bool MeshCache::open(const std::filesystem::path& cachePath) {
+        if (!file.open(cachePath) || !view(file.view())) {
+            file.close();
+            return false;
+        }
+        return true;
+    }
+
+    bool MeshCache::view(std::string_view bytes) {
+        vertices = {};
+        indices = {};
+        submeshes = {};
+        strings = {};
+        if (bytes.size() < sizeof(Header) || reinterpret_cast<uintptr_t>(bytes.data()) % alignof(MeshVertex) != 0) {
+            return false;
+        }
+        std::memcpy(&header, bytes.data(), sizeof(Header));
+        if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version) {
+            return false;
+        }
+
+        // Each section must lie inside the file and be aligned for its element type
+        auto section = [&](uint64_t offset, uint64_t count, uint64_t elementSize) {
+            return offset % SectionAlignment == 0 && offset <= bytes.size() && count <= (bytes.size() - offset) / elementSize;
+        };
+        if (!section(header.vertexOffset, header.vertexCount, sizeof(MeshVertex))
+            || !section(header.indexOffset, header.indexCount, sizeof(uint32_t))
+            || !section(header.submeshOffset, header.submeshCount, sizeof(SubmeshRecord))
+            || !section(header.stringsOffset, header.stringsSize, 1)) {
+            return false;
+        }
+
+        vertices = {reinterpret_cast<const MeshVertex*>(bytes.data() + header.vertexOffset), header.vertexCount};
+        indices = {reinterpret_cast<const uint32_t*>(bytes.data() + header.indexOffset), header.indexCount};
+        submeshes = {reinterpret_cast<const SubmeshRecord*>(bytes.data() + header.submeshOffset), header.submeshCount};
+        strings = bytes.substr(header.stringsOffset, header.stringsSize);
+
+        for (const auto& submesh : submeshes) {
+            if (uint64_t(submesh.indexOffset) + submesh.indexCount > header.indexCount
+                || uint64_t(submesh.materialOffset) + submesh.materialLength > strings.size()) {
+                return false;
+            }
+        }
+        for (uint32_t index : indices) {
+            if (index >= header.vertexCount) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string_view MeshCache::getMaterial(const SubmeshRecord& submesh) const {
+        return strings.substr(submesh.materialOffset, submesh.materialLength);
+    }
+
+    std::string_view MeshCache::getMaterialLibrary() const {
+        // The library path comes first; submesh names follow it
+        uint32_t end = submeshes.empty() ? static_cast<uint32_t>(strings.size()) : submeshes.front().materialOffset;
+        return strings.substr(0, end);
+    }
+
+    std::unique_ptr<Mesh> MeshCache::toMesh() const {
+        auto mesh = std::make_unique<Mesh>();
+        mesh->vertices.assign(vertices.begin(), vertices.end());
+        mesh->indices.assign(indices.begin(), indices.end());
+        mesh->submeshes.reserve(submeshes.size());
+        for (const auto& record : submeshes) {
+            mesh->submeshes.push_back({record.indexOffset, record.indexCount, std::string(getMaterial(record))});
+        }
+        mesh->materialLibrary = getMaterialLibrary();
+        std::copy(std::begin(header.boundsMin), std::end(header.boundsMin), mesh->boundsMin);
+        std::copy(std::begin(header.boundsMax), std::end(header.boundsMax), mesh->boundsMax);
+        return mesh;
+    }
+
+} // namespace parteeengine::assets
@@ -0,0 +1,95 @@
+#include "engine/assets/VirtualFileSystem.hpp"
+
+#include <fstream>
+#include <mutex>
+
+namespace parteeengine::assets {
+
+    bool VirtualFileSystem::mount(const std::filesystem::path& packPath) {
+        auto pack = std::make_shared<AssetPack>();
+        if (!pack->open(packPath)) {
+            return false;
+        }
+        std::unique_lock lock(mutex);
+        packs.push_back(std::move(pack));
+        return true;
+    }
+
+    void VirtualFileSystem::unmountAll() {
+        std::unique_lock lock(mutex);
+        // Outstanding FileData keep their pack mapped until they are released
+        packs.clear();
+    }
+
+    size_t VirtualFileSystem::getMountCount() const {
+        std::shared_lock lock(mutex);
+        return packs.size();
+    }
+
+    bool VirtualFileSystem::read(std::string_view path, FileData& out) const {
+        out.pack.reset();
+        out.mapped = {};
+        out.buffer.clear();
+        {
+            std::shared_lock lock(mutex);
+            for (auto it = packs.rbegin(); it != packs.rend(); ++it) {
+                const pack::PackEntry* entry = (*it)->find(path);
+                if (!entry) {
+                    continue;
+                }
+                if (entry->flags & pack::EntryCompressed) {
+                    return (*it)->read(*entry, out.buffer);
+                }
+                out.pack = *it;
+                out.mapped = (*it)->stored(*entry);
+                return true;
+            }
+        }
+
+        std::filesystem::path resolved = resolveLoosePath(std::string(path));
+        if (resolved.empty()) {
+            return false;
+        }
+        std::ifstream file(resolved, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        out.buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return !file.bad();
+    }
+
+    bool VirtualFileSystem::exists(std::string_view path) const {
+        {
+            std::shared_lock lock(mutex);
+            for (const auto& pack : packs) {
+                if (pack->find(path)) {
+                    return true;
+                }
+            }
+        }
+        return !resolveLoosePath(std::string(path)).empty();
+    }
+
+    std::filesystem::path VirtualFileSystem::resolveLoosePath(const std::string& path) {
+        std::error_code error;
+        std::filesystem::path requested(path);
+        if (requested.is_absolute()) {
+            return std::filesystem::is_regular_file(requested, error) ? requested : std::filesystem::path();
+        }
+
+        // Walk up from the working directory, like ScriptLoader does for scripts
+        std::filesystem::path current = std::filesystem::current_path(error);
+        for (int i = 0; i < 7 && !current.empty(); ++i) {
+            std::filesystem::path candidate = current / requested;
+            if (std::filesystem::is_regular_file(candidate, error)) {
+                return candidate;
+            }
+            if (!current.has_parent_path() || current.parent_path() == current) {
+                break;
+            }
+            current = current.parent_path();
+        }
+        return {};
+    }
+
+} // namespace parteeengine::assets
@@ -1,8 +1,34 @@
 #include "engine/core/Engine.hpp"
 
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/core/metrics/Metrics.hpp"
+#include "engine/util/TypeName.hpp"
+
+#include <algorithm>
+
 namespace parteeengine {
 
-    Engine::Engine() : moduleManager(), entityManager(), moduleInput(entityManager), interpreter(this) {
+    // Label set for the script metric queries: (name) or (name, labelKey, labelValue), all strings.
+    static std::string metricLabels(const std::vector<interpreter::Value>& args, const std::string& function) {
+        const bool valid = (args.size() == 1 || args.size() == 3)
+            && std::all_of(args.begin(), args.end(), [](const interpreter::Value& arg) { return arg.type == interpreter::Value::Type::String; });
+        if (!valid) {
+            throw std::runtime_error(function + " expects a metric name and optionally a label key and value");
+        }
+        return args.size() == 3 ? metrics::Metrics::label(std::get<std::string>(args[1].data), std::get<std::string>(args[2].data)) : std::string();
+    }
+
+    static interpreter::Value summaryObject(const metrics::Summary& summary) {
+        return interpreter::ObjectBuilder{}
+            .addProperty("p50", interpreter::Value(summary.p50))
+            .addProperty("p95", interpreter::Value(summary.p95))
+            .addProperty("p99", interpreter::Value(summary.p99))
+            .addProperty("max", interpreter::Value(summary.max))
+            .addProperty("count", interpreter::Value(static_cast<double>(summary.count)))
+            .build();
+    }
+
+    Engine::Engine() : entityManager(), moduleManager(), eventBus(), assetManager(), moduleInput(entityManager, 0.f, &eventBus), interpreter(this) {
         // Expose engine interface to the scripting environment
         interpreter.ExposeObject("Engine", getEngineInterface());
     }
@@ -21,12 +47,46 @@ namespace parteeengine {
                 .addProperty("__generation", interpreter::Value(static_cast<double>(entity.generation)))
                 .build();
         });
+        builder.addFunction("random", [this](std::vector<interpreter::Value> args) -> interpreter::Value {
+            // random() -> [0, 1), random(min, max) -> [min, max)
+            double min = 0, max = 1;
+            if (args.size() == 2 && args[0].type == interpreter::Value::Type::Number && args[1].type == interpreter::Value::Type::Number) {
+                min = std::get<double>(args[0].data);
+                max = std::get<double>(args[1].data);
+            } else if (!args.empty()) {
+                throw std::runtime_error("random expects no arguments or (min, max)");
+            }
+            return interpreter::Value(std::uniform_real_distribution<double>(min, max)(scriptRandom));
+        });
+        builder.addFunction("getFrameStats", [](std::vector<interpreter::Value> args) -> interpreter::Value {
+            if (!args.empty()) {
+                throw std::runtime_error("getFrameStats does not take any arguments");
+            }
+            return summaryObject(metrics::Metrics::getSummary(metrics::names::FrameTime));
+        });
+        // getMetric(name) reads an unlabelled gauge, getMetric(name, labelKey, labelValue) a labelled one,
+        // e.g. getMetric("partee_render_command_count", "bucket", "QuadRenderCommand").
+        builder.addFunction("getMetric", [](std::vector<interpreter::Value> args) -> interpreter::Value {
+            const std::string labels = metricLabels(args, "getMetric");
+            return interpreter::Value(metrics::Metrics::getGauge(std::get<std::string>(args[0].data), labels));
+        });
+        // Like getFrameStats for any summary series, with the same optional label as getMetric.
+        builder.addFunction("getMetricStats", [](std::vector<interpreter::Value> args) -> interpreter::Value {
+            const std::string labels = metricLabels(args, "getMetricStats");
+            return summaryObject(metrics::Metrics::getSummary(std::get<std::string>(args[0].data), labels));
+        });
+        builder.addFunction("dumpMetrics", [](std::vector<interpreter::Value> args) -> interpreter::Value {
+            if (args.size() != 1 || args[0].type != interpreter::Value::Type::String) {
+                throw std::runtime_error("dumpMetrics expects a file path");
+            }
+            return interpreter::Value(metrics::Metrics::writePrometheus(std::get<std::string>(args[0].data)));
+        });
         // Additional engine functions can be exposed here
         return builder.build();
     }
 
     void Engine::addScript(std::string script) {
-        scripts.push_back(script);
+        scripts.push_back(assetManager.load<assets::TextAsset>(script));
     }
 
     Entity Engine::createEntity() {
@@ -42,27 +102,115 @@ namespace parteeengine {
     }
 
     void Engine::run() {
+        runLoop([](uint64_t, float) { return false; });
+    }
+
+    void Engine::runFrames(uint64_t frameCount) {
+        runLoop([frameCount](uint64_t framesRun, float) { return framesRun >= frameCount; });
+    }
+
+    void Engine::runFor(float seconds) {
+        runLoop([seconds](uint64_t, float elapsed) { return elapsed >= seconds; });
+    }
+
+    void Engine::setFixedDeltaTime(float dt) {
+        fixedDeltaTime = dt;
+    }
+
+    bool Engine::recordReplay(const std::string& filePath) {
+        replayPlayer.close();
+        return replayRecorder.open(filePath);
+    }
+
+    bool Engine::playReplay(const std::string& filePath) {
+        replayRecorder.close();
+        return replayPlayer.open(filePath);
+    }
+
+    void Engine::runLoop(const std::function<bool(uint64_t, float)>& shouldStop) {
         lastFrameTime = std::chrono::steady_clock::now().time_since_epoch().count();
         if (!moduleManager.initializeModules(moduleInput)) {
+            std::cerr << "Module initialization failed\n";
             return;
         }
 
         for (const auto& script : scripts) {
-            interpreter.interpret(script);
+            // Usually loaded already; the loader threads had all of module initialization
+            const assets::TextAsset* source = script.wait();
+            if (!source) {
+                std::cerr << "Failed to load script " << script.getPath() << ": " << script.getError() << "\n";
+                continue;
+            }
+            // Report script failures like parse errors instead of taking the engine down
+            try {
+                interpreter.interpretSource(source->text);
+            } catch (const std::exception& e) {
+                std::cerr << "Script error in " << script.getPath() << ": " << e.what() << "\n";
+            }
+        }
+
+        const std::time_t startTime = std::chrono::steady_clock::now().time_since_epoch().count();
+        uint64_t framesRun = 0;
+
+        if (replayPlayer.isOpen()) {
+            input::InputSystem::setMode(input::InputMode::Replaying);
+        } else if (replayRecorder.isOpen()) {
+            input::InputSystem::setMode(input::InputMode::Recording);
         }
 
         running = true;
-        while (running) {
+        while (running && !shouldStop(framesRun, static_cast<float>(lastFrameTime - startTime) / 1000000000.0f)) {
+            PARTEE_PROFILE_ZONE("Engine::frame");
             std::time_t currentFrameTime = std::chrono::steady_clock::now().time_since_epoch().count();
             moduleInput.dt = static_cast<float>(currentFrameTime - lastFrameTime) / 1000000000.0f; // Convert nanoseconds to seconds
             lastFrameTime = currentFrameTime;
+            if (fixedDeltaTime > 0.f) {
+                moduleInput.dt = fixedDeltaTime;
+            }
+
+            uint64_t randomSeed = seedSource();
+            if (replayPlayer.isOpen()) {
+                replay::ReplayFrame replayFrame;
+                if (!replayPlayer.nextFrame(replayFrame)) {
+                    break; // End of the replay
+                }
+                moduleInput.dt = replayFrame.dt;
+                randomSeed = replayFrame.randomSeed;
+                input::InputSystem::setFrameState(std::move(replayFrame.inputs));
+            }
+            scriptRandom.seed(randomSeed);
+
             if (!moduleManager.updateModules(moduleInput)) {
                 running = false;
             }
+            // Sync point: every module has run, so no publisher is active
+            assetManager.update(&eventBus);
+            eventBus.dispatch();
+            if (replayRecorder.isOpen()) {
+                replayRecorder.recordFrame({moduleInput.dt, randomSeed, input::InputSystem::getFrameState()});
+            }
+            recordFrameMetrics();
 
-            input::InputSystem::poll();
+            {
+                PARTEE_PROFILE_ZONE("InputSystem::poll");
+                input::InputSystem::poll();
+            }
+
+            ++framesRun;
+        }
+        running = false;
+
+        replayRecorder.close();
+        replayPlayer.close();
+        input::InputSystem::setMode(input::InputMode::Live);
+    }
 
-            std::cout << "Frame Time: " << moduleInput.dt << " seconds\n";
+    void Engine::recordFrameMetrics() {
+        metrics::Metrics::observe(metrics::names::FrameTime, moduleInput.dt);
+        metrics::Metrics::setGauge(metrics::names::EntityCount, static_cast<double>(entityManager.getEntityCount()));
+        for (const auto& [type, count] : entityManager.getComponentCounts()) {
+            metrics::Metrics::setGauge(metrics::names::ComponentCount, static_cast<double>(count),
+                metrics::Metrics::label("component", readableTypeName(type)));
         }
     }
 
@@ -29,4 +29,17 @@ namespace parteeengine {
         return entity.id < generations.size() && generations[entity.id] == entity.generation;
     }
 
+    size_t EntityManager::getEntityCount() const {
+        return generations.size() - freeIds.size();
+    }
+
+    std::vector<std::pair<std::type_index, size_t>> EntityManager::getComponentCounts() const {
+        std::vector<std::pair<std::type_index, size_t>> counts;
+        counts.reserve(entityComponents.size());
+        for (const auto& [compId, compArray] : entityComponents) {
+            counts.emplace_back(compId, compArray->size());
+        }
+        return counts;
+    }
+
 } // namespace parteeengine
\ No newline at end of file
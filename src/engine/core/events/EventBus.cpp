@@ -0,0 +1,36 @@
+#include "engine/core/events/EventBus.hpp"
+
+#include "engine/core/metrics/Metrics.hpp"
+
+namespace parteeengine::events {
+
+    std::vector<void*>& detail::threadSlots() {
+        thread_local std::vector<void*> slots;
+        return slots;
+    }
+
+    bool EventBus::unsubscribe(SubscriptionId id) {
+        for (const auto& queue : queues) {
+            if (queue->unsubscribe(id)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t EventBus::dispatch() {
+        PARTEE_PROFILE_ZONE("EventBus::dispatch");
+        size_t delivered = 0;
+        // Indexed, since a handler may publish a new event type and grow the list
+        for (size_t i = 0; i < queues.size(); ++i) {
+            IEventQueue* queue = queues[i].get();
+            PARTEE_PROFILE_ZONE(queue->getName());
+            size_t count = queue->dispatch();
+            metrics::Metrics::setGauge(metrics::names::EventCount, static_cast<double>(count),
+                metrics::Metrics::label("event", queue->getName()));
+            delivered += count;
+        }
+        return delivered;
+    }
+
+} // namespace parteeengine::events
@@ -0,0 +1,108 @@
+#include "engine/core/jobs/JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace parteeengine::jobs {
+
+    JobSystem::Pool::Pool() {
+        size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1;
+        workers.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    JobSystem::Pool::~Pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void JobSystem::Pool::submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        wake.notify_one();
+    }
+
+    void JobSystem::Pool::workerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    JobSystem::Pool& JobSystem::pool() {
+        static Pool instance;
+        return instance;
+    }
+
+    size_t JobSystem::getConcurrency() {
+        return pool().workers.size() + 1;
+    }
+
+    void JobSystem::parallelFor(size_t count, size_t minBatchSize, const std::function<void(size_t, size_t)>& fn) {
+        if (count == 0) {
+            return;
+        }
+        minBatchSize = std::max<size_t>(minBatchSize, 1);
+        size_t batches = std::min((count + minBatchSize - 1) / minBatchSize, getConcurrency());
+        if (batches <= 1) {
+            fn(0, count);
+            return;
+        }
+
+        // Shared between the caller and helper tasks; helpers that start after all
+        // batches are claimed exit immediately, so the state must outlive this call.
+        struct State {
+            std::atomic<size_t> nextBatch{0};
+            std::atomic<size_t> remaining;
+            std::mutex mutex;
+            std::condition_variable done;
+        };
+        auto state = std::make_shared<State>();
+        state->remaining.store(batches);
+
+        size_t batchSize = (count + batches - 1) / batches;
+        auto runBatches = [state, batches, batchSize, count, &fn] {
+            size_t batch;
+            while ((batch = state->nextBatch.fetch_add(1)) < batches) {
+                size_t begin = batch * batchSize;
+                size_t end = std::min(begin + batchSize, count);
+                if (begin < end) {
+                    fn(begin, end);
+                }
+                if (state->remaining.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->done.notify_all();
+                }
+            }
+        };
+
+        for (size_t i = 1; i < batches; ++i) {
+            pool().submit(runBatches);
+        }
+        runBatches();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&] { return state->remaining.load() == 0; });
+    }
+
+} // namespace parteeengine::jobs
@@ -0,0 +1,129 @@
+#include "engine/core/metrics/Metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+namespace parteeengine::metrics {
+
+    Summary RollingWindow::summarize() const {
+        Summary summary;
+        summary.count = count;
+        if (count == 0) {
+            return summary;
+        }
+
+        size_t n = static_cast<size_t>(std::min<uint64_t>(count, WindowSize));
+        std::vector<double> sorted(samples.begin(), samples.begin() + n);
+        std::sort(sorted.begin(), sorted.end());
+
+        // Nearest-rank percentile: the smallest sample with at least p of the window at or below it
+        auto rank = [&](double p) {
+            const size_t index = static_cast<size_t>(std::ceil(p * static_cast<double>(n)));
+            return sorted[std::min(index > 0 ? index - 1 : 0, n - 1)];
+        };
+        summary.p50 = rank(0.50);
+        summary.p95 = rank(0.95);
+        summary.p99 = rank(0.99);
+        summary.max = sorted.back();
+        return summary;
+    }
+
+    std::string Metrics::label(const std::string& key, const std::string& value) {
+        std::string result = key + "=\"";
+        for (char c : value) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+                result += c;
+            } else if (c == '\n') {
+                result += "\\n";
+            } else {
+                result += c;
+            }
+        }
+        result += '"';
+        return result;
+    }
+
+    void Metrics::observe(const std::string& name, double value, const std::string& labels) {
+        std::lock_guard<std::mutex> lock(mutex);
+        summaries[{name, labels}].add(value);
+    }
+
+    void Metrics::setGauge(const std::string& name, double value, const std::string& labels) {
+        std::lock_guard<std::mutex> lock(mutex);
+        gauges[{name, labels}] = value;
+    }
+
+    Summary Metrics::getSummary(const std::string& name, const std::string& labels) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = summaries.find({name, labels});
+        if (it == summaries.end()) {
+            return {};
+        }
+        return it->second.summarize();
+    }
+
+    double Metrics::getGauge(const std::string& name, const std::string& labels) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = gauges.find({name, labels});
+        if (it == gauges.end()) {
+            return 0;
+        }
+        return it->second;
+    }
+
+    void Metrics::clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        summaries.clear();
+        gauges.clear();
+    }
+
+    bool Metrics::writePrometheus(const std::string& filePath) {
+        std::ofstream file(filePath);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // Joins the series labels with an extra label, producing {a="x",quantile="0.5"}
+        auto withLabel = [](const std::string& labels, const std::string& extra) {
+            if (labels.empty()) return "{" + extra + "}";
+            return "{" + labels + "," + extra + "}";
+        };
+        auto braced = [](const std::string& labels) {
+            return labels.empty() ? std::string() : "{" + labels + "}";
+        };
+
+        // Maps are ordered by name, so each family's series are contiguous
+        std::string lastName;
+        for (const auto& [key, window] : summaries) {
+            const auto& [name, labels] = key;
+            if (name != lastName) {
+                file << "# TYPE " << name << " summary\n";
+                lastName = name;
+            }
+            Summary summary = window.summarize();
+            file << name << withLabel(labels, "quantile=\"0.5\"") << " " << summary.p50 << "\n";
+            file << name << withLabel(labels, "quantile=\"0.95\"") << " " << summary.p95 << "\n";
+            file << name << withLabel(labels, "quantile=\"0.99\"") << " " << summary.p99 << "\n";
+            file << name << withLabel(labels, "quantile=\"1\"") << " " << summary.max << "\n";
+            file << name << "_count" << braced(labels) << " " << summary.count << "\n";
+        }
+
+        lastName.clear();
+        for (const auto& [key, value] : gauges) {
+            const auto& [name, labels] = key;
+            if (name != lastName) {
+                file << "# TYPE " << name << " gauge\n";
+                lastName = name;
+            }
+            file << name << braced(labels) << " " << value << "\n";
+        }
+
+        return file.good();
+    }
+
+} // namespace parteeengine::metrics
@@ -0,0 +1,115 @@
+#include "engine/core/modules/KinematicsModule.hpp"
+
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/jobs/JobSystem.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+
+namespace parteeengine {
+
+    namespace {
+        constexpr size_t BlockSize = 256;       // Entities staged per SIMD block; fits comfortably in L1
+        constexpr size_t MinParallelBatch = 4096; // Below this, thread handoff costs more than it saves
+    } // namespace
+
+    bool KinematicsModule::initialize([[maybe_unused]]const ModuleInput& input) {
+        return true;
+    }
+
+    bool KinematicsModule::update(const ModuleInput& input) {
+        refreshBindings(input.entityManager);
+
+        const float dt = input.dt;
+        if (threaded) {
+            jobs::JobSystem::parallelFor(bindings.size(), MinParallelBatch, [this, dt](size_t begin, size_t end) {
+                integrateRange(begin, end, dt);
+            });
+        } else {
+            integrateRange(0, bindings.size(), dt);
+        }
+        return true;
+    }
+
+    KinematicsModule& KinematicsModule::setThreaded(bool threaded) {
+        this->threaded = threaded;
+        return *this;
+    }
+
+    void KinematicsModule::refreshBindings(const EntityManager& entityManager) {
+        uint64_t transforms = entityManager.getComponentVersion<TransformComponent2d>();
+        uint64_t velocities = entityManager.getComponentVersion<Velocity2d>();
+        uint64_t accelerations = entityManager.getComponentVersion<Acceleration2d>();
+        if (bindingsValid && transforms == transformVersion && velocities == velocityVersion && accelerations == accelerationVersion) {
+            return;
+        }
+
+        PARTEE_PROFILE_ZONE("Kinematics::refreshBindings");
+        bindings.clear();
+        for (auto& [entity, velocity] : entityManager.getEntityComponentPairs<Velocity2d>()) {
+            auto* transform = entityManager.getComponent<TransformComponent2d>(entity);
+            if (!transform) {
+                continue;
+            }
+            bindings.push_back({&transform->transform, &velocity, entityManager.getComponent<Acceleration2d>(entity)});
+        }
+
+        transformVersion = transforms;
+        velocityVersion = velocities;
+        accelerationVersion = accelerations;
+        bindingsValid = true;
+    }
+
+    void KinematicsModule::integrateRange(size_t begin, size_t end, float dt) {
+        // Components are scattered across arrays, so each block is staged into SoA
+        // lanes, integrated with SIMD and written back.
+        alignas(16) float px[BlockSize], py[BlockSize], rot[BlockSize];
+        alignas(16) float vx[BlockSize], vy[BlockSize], va[BlockSize];
+        alignas(16) float ax[BlockSize], ay[BlockSize], aa[BlockSize];
+
+        const simd::Float4 step = simd::set1(dt);
+
+        for (size_t blockBegin = begin; blockBegin < end; blockBegin += BlockSize) {
+            const size_t count = std::min(BlockSize, end - blockBegin);
+            const size_t padded = (count + simd::Width - 1) / simd::Width * simd::Width;
+
+            for (size_t i = 0; i < count; ++i) {
+                const Binding& binding = bindings[blockBegin + i];
+                px[i] = binding.transform->position.x;
+                py[i] = binding.transform->position.y;
+                rot[i] = binding.transform->rotation;
+                vx[i] = binding.velocity->linear.x;
+                vy[i] = binding.velocity->linear.y;
+                va[i] = binding.velocity->angular;
+                ax[i] = binding.acceleration ? binding.acceleration->linear.x : 0.f;
+                ay[i] = binding.acceleration ? binding.acceleration->linear.y : 0.f;
+                aa[i] = binding.acceleration ? binding.acceleration->angular : 0.f;
+            }
+            for (size_t i = count; i < padded; ++i) {
+                px[i] = py[i] = rot[i] = vx[i] = vy[i] = va[i] = ax[i] = ay[i] = aa[i] = 0.f;
+            }
+
+            for (size_t i = 0; i < padded; i += simd::Width) {
+                simd::Float4 newVx = simd::load(&vx[i]) + simd::load(&ax[i]) * step;
+                simd::Float4 newVy = simd::load(&vy[i]) + simd::load(&ay[i]) * step;
+                simd::Float4 newVa = simd::load(&va[i]) + simd::load(&aa[i]) * step;
+                simd::store(&vx[i], newVx);
+                simd::store(&vy[i], newVy);
+                simd::store(&va[i], newVa);
+                simd::store(&px[i], simd::load(&px[i]) + newVx * step);
+                simd::store(&py[i], simd::load(&py[i]) + newVy * step);
+                simd::store(&rot[i], simd::load(&rot[i]) + newVa * step);
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                const Binding& binding = bindings[blockBegin + i];
+                binding.transform->position = Vector2(px[i], py[i]);
+                binding.transform->rotation = rot[i];
+                binding.velocity->linear = Vector2(vx[i], vy[i]);
+                binding.velocity->angular = va[i];
+            }
+        }
+    }
+
+} // namespace parteeengine
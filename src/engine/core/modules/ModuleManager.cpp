@@ -1,10 +1,13 @@
 #include "engine/core/modules/ModuleManager.hpp"
 
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/core/metrics/Metrics.hpp"
+
 namespace parteeengine {
 
     bool ModuleManager::initializeModules(const ModuleInput& inputs) {
-        for (auto& [type, module] : modules) {
-            if (!module->initialize(inputs)) {
+        for (auto& [type, entry] : modules) {
+            if (!entry.module->initialize(inputs)) {
                 return false;
             }
         }
@@ -12,8 +15,14 @@ namespace parteeengine {
     }
 
     bool ModuleManager::updateModules(const ModuleInput& inputs) {
-        for (auto& [type, module] : modules) {
-            if (!module->update(inputs)) {
+        for (auto& [type, entry] : modules) {
+            PARTEE_PROFILE_ZONE(entry.name);
+            uint64_t start = profiling::Profiler::now();
+            bool ok = entry.module->update(inputs);
+            metrics::Metrics::observe(metrics::names::ModuleUpdateTime,
+                static_cast<double>(profiling::Profiler::now() - start) / 1e9,
+                metrics::Metrics::label("module", entry.name));
+            if (!ok) {
                 return false;
             }
         }
@@ -0,0 +1,88 @@
+#include "engine/core/profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+
+namespace parteeengine::profiling {
+
+    // Chrome trace timestamps are microseconds; keep nanosecond precision as a fixed fraction.
+    static void writeMicroseconds(std::ostream& out, uint64_t ns) {
+        char fraction[4] = {
+            static_cast<char>('0' + ns % 1000 / 100),
+            static_cast<char>('0' + ns % 100 / 10),
+            static_cast<char>('0' + ns % 10),
+            '\0'
+        };
+        out << ns / 1000 << "." << fraction;
+    }
+
+    void ProfileRingBuffer::snapshot(std::vector<ProfileEvent>& out) const {
+        uint64_t end = head.load(std::memory_order_acquire);
+        uint64_t begin = std::max(tail.load(std::memory_order_acquire), end > Capacity ? end - Capacity : 0);
+
+        size_t firstOut = out.size();
+        for (uint64_t i = begin; i < end; ++i) {
+            out.push_back(events[i & (Capacity - 1)]);
+        }
+
+        // Anything the writer lapped while we copied is unreliable; drop it. The writer may
+        // also be in the middle of writing index after, which overwrites after - Capacity.
+        uint64_t after = head.load(std::memory_order_acquire);
+        if (after >= begin + Capacity) {
+            size_t lapped = static_cast<size_t>(std::min<uint64_t>(after + 1 - Capacity - begin, end - begin));
+            out.erase(out.begin() + firstOut, out.begin() + firstOut + lapped);
+        }
+    }
+
+    ProfileRingBuffer& Profiler::threadBuffer() {
+        thread_local ProfileRingBuffer* buffer = nullptr;
+        if (!buffer) {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            buffers.push_back(std::make_unique<ProfileRingBuffer>(static_cast<uint32_t>(buffers.size())));
+            buffer = buffers.back().get();
+        }
+        return *buffer;
+    }
+
+    void Profiler::clear() {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (auto& buffer : buffers) {
+            buffer->clear();
+        }
+    }
+
+    bool Profiler::exportChromeTrace(const std::string& filePath) {
+        std::ofstream file(filePath);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+
+        file << "{\"traceEvents\":[";
+        bool first = true;
+        std::vector<ProfileEvent> events;
+        for (const auto& buffer : buffers) {
+            events.clear();
+            buffer->snapshot(events);
+            for (const auto& event : events) {
+                if (!first) file << ",";
+                first = false;
+
+                file << "\n{\"name\":\"";
+                for (const char* c = event.name ? event.name : "unnamed"; *c; ++c) {
+                    if (*c == '"' || *c == '\\') file << '\\';
+                    file << *c;
+                }
+                file << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->getThreadId() << ",\"ts\":";
+                writeMicroseconds(file, event.startNs);
+                file << ",\"dur\":";
+                writeMicroseconds(file, event.endNs - event.startNs);
+                file << "}";
+            }
+        }
+        file << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return file.good();
+    }
+
+} // namespace parteeengine::profiling
@@ -0,0 +1,133 @@
+#include "engine/core/replay/Replay.hpp"
+
+#include <algorithm>
+
+namespace parteeengine::replay {
+
+    template<typename T>
+    static void writeValue(std::ofstream& file, const T& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    static bool readValue(std::ifstream& file, T& value) {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    bool ReplayRecorder::open(const std::string& filePath) {
+        close();
+        file.open(filePath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(format::Magic, sizeof(format::Magic));
+        writeValue(file, format::Version);
+        return file.good();
+    }
+
+    void ReplayRecorder::close() {
+        if (file.is_open()) {
+            file.close();
+        }
+        deviceIndices.clear();
+    }
+
+    uint16_t ReplayRecorder::deviceIndex(std::string_view device) {
+        auto it = deviceIndices.find(device);
+        if (it != deviceIndices.end()) {
+            return it->second;
+        }
+        uint16_t index = static_cast<uint16_t>(deviceIndices.size());
+        deviceIndices.emplace(device, index);
+
+        uint16_t length = static_cast<uint16_t>(std::min<size_t>(device.size(), UINT16_MAX));
+        writeValue(file, format::DeviceRecord);
+        writeValue(file, length);
+        file.write(device.data(), length);
+        return index;
+    }
+
+    void ReplayRecorder::recordFrame(const ReplayFrame& frame) {
+        if (!file.is_open()) {
+            return;
+        }
+
+        // Device records must precede the frame that references them
+        std::vector<uint16_t> devices;
+        devices.reserve(frame.inputs.size());
+        for (const auto& sample : frame.inputs) {
+            devices.push_back(deviceIndex(sample.device));
+        }
+
+        writeValue(file, format::FrameRecord);
+        writeValue(file, frame.dt);
+        writeValue(file, frame.randomSeed);
+        writeValue(file, static_cast<uint16_t>(frame.inputs.size()));
+        for (size_t i = 0; i < frame.inputs.size(); ++i) {
+            writeValue(file, devices[i]);
+            writeValue(file, frame.inputs[i].id);
+            writeValue(file, frame.inputs[i].deviceIndex);
+            writeValue(file, frame.inputs[i].value);
+        }
+    }
+
+    bool ReplayPlayer::open(const std::string& filePath) {
+        close();
+        file.open(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        char magic[sizeof(format::Magic)];
+        uint32_t version = 0;
+        if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), format::Magic)
+            || !readValue(file, version) || version != format::Version) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void ReplayPlayer::close() {
+        if (file.is_open()) {
+            file.close();
+        }
+        deviceNames.clear();
+    }
+
+    bool ReplayPlayer::nextFrame(ReplayFrame& frame) {
+        uint8_t tag = 0;
+        while (readValue(file, tag)) {
+            if (tag == format::DeviceRecord) {
+                uint16_t length = 0;
+                if (!readValue(file, length)) return false;
+                std::string name(length, '\0');
+                if (!file.read(name.data(), length)) return false;
+                deviceNames.push_back(std::move(name));
+            } else if (tag == format::FrameRecord) {
+                uint16_t count = 0;
+                if (!readValue(file, frame.dt) || !readValue(file, frame.randomSeed) || !readValue(file, count)) {
+                    return false;
+                }
+                frame.inputs.clear();
+                frame.inputs.reserve(count);
+                for (uint16_t i = 0; i < count; ++i) {
+                    uint16_t device = 0;
+                    input::InputSample sample{};
+                    if (!readValue(file, device) || !readValue(file, sample.id)
+                        || !readValue(file, sample.deviceIndex) || !readValue(file, sample.value)) {
+                        return false;
+                    }
+                    if (device >= deviceNames.size()) return false;
+                    sample.device = deviceNames[device];
+                    frame.inputs.push_back(sample);
+                }
+                return true;
+            } else {
+                return false;
+            }
+        }
+        return false;
+    }
+
+} // namespace parteeengine::replay
@@ -3,6 +3,12 @@
 namespace parteeengine::input {
 
     void InputSystem::poll() {
+        if (mode == InputMode::Replaying) {
+            return;
+        }
+        if (mode == InputMode::Recording) {
+            frameState.clear();
+        }
         for (auto& [type, deviceList] : devices) {
             for (auto& device : deviceList) {
                 device->poll();
@@ -11,19 +17,66 @@ namespace parteeengine::input {
     }
 
     bool InputSystem::isActive(InputBinding binding) {
+        if (mode == InputMode::Replaying) {
+            const InputSample* sample = findSample(binding);
+            return sample && sample->value != 0.f;
+        }
+
+        bool active = false;
         auto deviceList = devices.find(binding.type);
         if (deviceList != devices.end() && binding.deviceIndex < deviceList->second.size()) {
-            return deviceList->second[binding.deviceIndex]->isActive(binding);
+            active = deviceList->second[binding.deviceIndex]->isActive(binding);
+        }
+        if (mode == InputMode::Recording) {
+            storeSample(binding, active ? 1.f : 0.f);
         }
-        return false;
+        return active;
     }
 
     float InputSystem::getAnalog(InputBinding binding) {
+        if (mode == InputMode::Replaying) {
+            const InputSample* sample = findSample(binding);
+            return sample ? sample->value : 0.f;
+        }
+
+        float value = 0.f;
         auto deviceList = devices.find(binding.type);
         if (deviceList != devices.end() && binding.deviceIndex < deviceList->second.size()) {
-            return deviceList->second[binding.deviceIndex]->getAnalog(binding);
+            value = deviceList->second[binding.deviceIndex]->getAnalog(binding);
+        }
+        if (mode == InputMode::Recording) {
+            storeSample(binding, value);
+        }
+        return value;
+    }
+
+    void InputSystem::setMode(InputMode newMode) {
+        mode = newMode;
+        frameState.clear();
+    }
+
+    void InputSystem::setFrameState(std::vector<InputSample> state) {
+        frameState = std::move(state);
+    }
+
+    const InputSample* InputSystem::findSample(const InputBinding& binding) {
+        std::string_view device = binding.type.name();
+        for (const auto& sample : frameState) {
+            if (sample.id == binding.id && sample.deviceIndex == binding.deviceIndex && sample.device == device) {
+                return &sample;
+            }
+        }
+        return nullptr;
+    }
+
+    void InputSystem::storeSample(const InputBinding& binding, float value) {
+        for (auto& sample : frameState) {
+            if (sample.id == binding.id && sample.deviceIndex == binding.deviceIndex && sample.device == binding.type.name()) {
+                sample.value = value;
+                return;
+            }
         }
-        return 0.f;
+        frameState.push_back(InputSample{binding.type.name(), binding.id, static_cast<uint16_t>(binding.deviceIndex), value});
     }
 
-} // namespace parteeengine::input
\ No newline at end of file
+} // namespace parteeengine::input
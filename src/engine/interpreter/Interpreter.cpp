@@ -1,5 +1,7 @@
 #include "engine/interpreter/Interpreter.hpp"
 
+#include <cmath>
+
 namespace interpreter {
 
     void Environment::define(const std::string& name, const Value& value) {
@@ -43,7 +45,11 @@ namespace interpreter {
     ReturnSignal::ReturnSignal(const Value& val) : returnValue(val) {}
 
     void Interpreter::interpret(const std::string& source) {
-        Lexer lexer(ScriptLoader::loadScript(source));
+        interpretSource(ScriptLoader::loadScript(source));
+    }
+
+    void Interpreter::interpretSource(const std::string& code) {
+        Lexer lexer(code);
         auto tokens = lexer.tokenize();
 
         Parser parser;
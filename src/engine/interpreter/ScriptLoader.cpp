@@ -1,6 +1,7 @@
 #include "engine/interpreter/ScriptLoader.hpp"
 #include <iostream>
 #include <filesystem>
+#include <vector>
 
 namespace interpreter {
 
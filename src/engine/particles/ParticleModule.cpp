@@ -0,0 +1,137 @@
+#include "engine/particles/ParticleModule.hpp"
+
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/core/jobs/JobSystem.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace parteeengine::particles {
+
+    namespace {
+        constexpr size_t EmittersPerBatch = 4;
+
+        // xorshift32; cheap and deterministic per emitter
+        float nextRandom(uint32_t& state) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return static_cast<float>(state >> 8) * (1.f / 16777216.f);
+        }
+
+        // Default seed for an emitter, mixed from its entity (murmur3 finalizer). Never 0, which xorshift can't leave.
+        uint32_t entitySeed(Entity entity) {
+            uint32_t h = entity.id * 0x9E3779B9u ^ entity.generation;
+            h ^= h >> 16;
+            h *= 0x85EBCA6Bu;
+            h ^= h >> 13;
+            h *= 0xC2B2AE35u;
+            h ^= h >> 16;
+            return h != 0 ? h : 0x9E3779B9u;
+        }
+    } // namespace
+
+    bool ParticleModule::initialize([[maybe_unused]]const ModuleInput& input) {
+        return true;
+    }
+
+    bool ParticleModule::update(const ModuleInput& input) {
+        PARTEE_PROFILE_ZONE("Particles::update");
+        auto emitters = input.entityManager.getEntityComponentPairs<ParticleEmitter>();
+        const float dt = input.dt;
+
+        jobs::JobSystem::parallelFor(emitters.size(), EmittersPerBatch, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                auto& [entity, emitter] = emitters[i];
+                if (!emitter.pool || emitter.pool->capacity != emitter.capacity) {
+                    emitter.pool = std::make_unique<ParticlePool>(emitter.capacity);
+                }
+                if (emitter.seed == 0) {
+                    emitter.seed = entitySeed(entity);
+                }
+
+                simulate(emitter, dt);
+                emitter.pool->compact();
+
+                if (auto* transform = input.entityManager.getComponent<TransformComponent2d>(entity)) {
+                    spawn(emitter, transform->transform.position.x + emitter.offset.x,
+                          transform->transform.position.y + emitter.offset.y, dt);
+                }
+            }
+        });
+        return true;
+    }
+
+    void ParticleModule::spawn(ParticleEmitter& emitter, float originX, float originY, float dt) {
+        ParticlePool& pool = *emitter.pool;
+        if (!emitter.emitting) {
+            emitter.spawnAccumulator = 0.f;
+            return;
+        }
+
+        emitter.spawnAccumulator += emitter.rate * dt;
+        size_t requested = static_cast<size_t>(emitter.spawnAccumulator);
+        emitter.spawnAccumulator -= static_cast<float>(requested);
+        size_t spawned = std::min(requested, pool.capacity - pool.count);
+
+        constexpr float degreesToRadians = std::numbers::pi_v<float> / 180.f;
+        for (size_t n = 0; n < spawned; ++n) {
+            size_t i = pool.count++;
+            float angle = (emitter.direction + (nextRandom(emitter.seed) - 0.5f) * emitter.spread) * degreesToRadians;
+            float speed = emitter.minSpeed + (emitter.maxSpeed - emitter.minSpeed) * nextRandom(emitter.seed);
+            float lifetime = emitter.minLifetime + (emitter.maxLifetime - emitter.minLifetime) * nextRandom(emitter.seed);
+
+            pool.posX[i] = originX;
+            pool.posY[i] = originY;
+            pool.velX[i] = std::cos(angle) * speed;
+            pool.velY[i] = std::sin(angle) * speed;
+            pool.r[i] = emitter.startColor.r;
+            pool.g[i] = emitter.startColor.g;
+            pool.b[i] = emitter.startColor.b;
+            pool.a[i] = emitter.startColor.a;
+            pool.life[i] = lifetime;
+            pool.inverseLifetime[i] = lifetime > 0.f ? 1.f / lifetime : 0.f;
+        }
+    }
+
+    void ParticleModule::simulate(ParticleEmitter& emitter, float dt) {
+        ParticlePool& pool = *emitter.pool;
+        const size_t padded = (pool.count + simd::Width - 1) / simd::Width * simd::Width;
+
+        const simd::Float4 step = simd::set1(dt);
+        const simd::Float4 one = simd::set1(1.f);
+        const simd::Float4 accelX = simd::set1(emitter.acceleration.x * dt);
+        const simd::Float4 accelY = simd::set1(emitter.acceleration.y * dt);
+        const Color& start = emitter.startColor;
+        const Color& end = emitter.endColor;
+        const simd::Float4 startR = simd::set1(start.r), deltaR = simd::set1(end.r - start.r);
+        const simd::Float4 startG = simd::set1(start.g), deltaG = simd::set1(end.g - start.g);
+        const simd::Float4 startB = simd::set1(start.b), deltaB = simd::set1(end.b - start.b);
+        const simd::Float4 startA = simd::set1(start.a), deltaA = simd::set1(end.a - start.a);
+
+        // Lanes past count are padding; updating them is harmless and keeps the loop branch-free
+        for (size_t i = 0; i < padded; i += simd::Width) {
+            simd::Float4 life = simd::load(&pool.life[i]) - step;
+            simd::store(&pool.life[i], life);
+
+            simd::Float4 vx = simd::load(&pool.velX[i]) + accelX;
+            simd::Float4 vy = simd::load(&pool.velY[i]) + accelY;
+            simd::store(&pool.velX[i], vx);
+            simd::store(&pool.velY[i], vy);
+            simd::store(&pool.posX[i], simd::load(&pool.posX[i]) + vx * step);
+            simd::store(&pool.posY[i], simd::load(&pool.posY[i]) + vy * step);
+
+            // Fraction of lifetime elapsed, clamped for particles that just died
+            simd::Float4 t = simd::min(one - life * simd::load(&pool.inverseLifetime[i]), one);
+            simd::store(&pool.r[i], startR + deltaR * t);
+            simd::store(&pool.g[i], startG + deltaG * t);
+            simd::store(&pool.b[i], startB + deltaB * t);
+            simd::store(&pool.a[i], startA + deltaA * t);
+        }
+    }
+
+} // namespace parteeengine::particles
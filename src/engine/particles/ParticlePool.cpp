@@ -0,0 +1,50 @@
+#include "engine/particles/ParticlePool.hpp"
+
+#include "engine/util/Simd.hpp"
+
+namespace parteeengine::particles {
+
+    ParticlePool::ParticlePool(size_t capacity) : capacity(capacity) {
+        // Round up so SIMD loops can always process whole blocks past count
+        size_t allocated = (capacity + simd::Width - 1) / simd::Width * simd::Width;
+        posX = std::make_unique<float[]>(allocated);
+        posY = std::make_unique<float[]>(allocated);
+        velX = std::make_unique<float[]>(allocated);
+        velY = std::make_unique<float[]>(allocated);
+        r = std::make_unique<float[]>(allocated);
+        g = std::make_unique<float[]>(allocated);
+        b = std::make_unique<float[]>(allocated);
+        a = std::make_unique<float[]>(allocated);
+        life = std::make_unique<float[]>(allocated);
+        inverseLifetime = std::make_unique<float[]>(allocated);
+    }
+
+    void ParticlePool::compact() {
+        const simd::Float4 zero = simd::set1(0.f);
+        size_t i = 0;
+        while (i < count) {
+            // Skip whole blocks of live particles
+            if (i + simd::Width <= count && simd::bitmask(simd::load(&life[i]) <= zero) == 0) {
+                i += simd::Width;
+                continue;
+            }
+            if (life[i] > 0.f) {
+                ++i;
+                continue;
+            }
+            size_t last = --count;
+            posX[i] = posX[last];
+            posY[i] = posY[last];
+            velX[i] = velX[last];
+            velY[i] = velY[last];
+            r[i] = r[last];
+            g[i] = g[last];
+            b[i] = b[last];
+            a[i] = a[last];
+            life[i] = life[last];
+            inverseLifetime[i] = inverseLifetime[last];
+            // Re-check slot i: the particle moved into it may be dead too
+        }
+    }
+
+} // namespace parteeengine::particles
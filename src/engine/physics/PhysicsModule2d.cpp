@@ -0,0 +1,488 @@
+#include "engine/physics/PhysicsModule2d.hpp"
+
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/core/events/EventBus.hpp"
+#include "engine/core/jobs/JobSystem.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <numeric>
+
+namespace parteeengine::physics {
+
+    namespace {
+
+        constexpr float PenetrationSlop = 0.01f;   // Overlap left unresolved to avoid jitter
+        constexpr float CorrectionPercent = 0.8f;  // Fraction of remaining overlap pushed out per step
+        constexpr size_t IslandsPerBatch = 16;     // Minimum islands per solver job
+        constexpr float FarAway = 1e30f;           // Padding lane position that never collides
+
+        // Separating axis test between two (possibly rotated) boxes. Normal points from a to b.
+        bool boxBox(float ax, float ay, float ahx, float ahy, float arot,
+                    float bx, float by, float bhx, float bhy, float brot,
+                    float& nx, float& ny, float& penetration) {
+            const float aCos = std::cos(arot), aSin = std::sin(arot);
+            const float bCos = std::cos(brot), bSin = std::sin(brot);
+            const float axes[4][2] = {{aCos, aSin}, {-aSin, aCos}, {bCos, bSin}, {-bSin, bCos}};
+            const float dx = bx - ax, dy = by - ay;
+
+            penetration = std::numeric_limits<float>::max();
+            for (const auto& axis : axes) {
+                const float ux = axis[0], uy = axis[1];
+                float ra = ahx * std::fabs(aCos * ux + aSin * uy) + ahy * std::fabs(-aSin * ux + aCos * uy);
+                float rb = bhx * std::fabs(bCos * ux + bSin * uy) + bhy * std::fabs(-bSin * ux + bCos * uy);
+                float distance = dx * ux + dy * uy;
+                float overlap = ra + rb - std::fabs(distance);
+                if (overlap <= 0.f) {
+                    return false;
+                }
+                if (overlap < penetration) {
+                    float sign = distance < 0.f ? -1.f : 1.f;
+                    penetration = overlap;
+                    nx = ux * sign;
+                    ny = uy * sign;
+                }
+            }
+            return true;
+        }
+
+        // Circle against a (possibly rotated) box. Normal points from the box to the circle.
+        bool circleBox(float cx, float cy, float r, float bx, float by, float hx, float hy, float rot,
+                       float& nx, float& ny, float& penetration) {
+            const float c = std::cos(rot), s = std::sin(rot);
+            const float dx = cx - bx, dy = cy - by;
+            const float lx = dx * c + dy * s;
+            const float ly = -dx * s + dy * c;
+            const float clampedX = std::clamp(lx, -hx, hx);
+            const float clampedY = std::clamp(ly, -hy, hy);
+
+            float localX, localY;
+            if (clampedX == lx && clampedY == ly) {
+                // Center inside the box: push out through the nearest face
+                float faceX = hx - std::fabs(lx);
+                float faceY = hy - std::fabs(ly);
+                if (faceX < faceY) {
+                    localX = lx < 0.f ? -1.f : 1.f;
+                    localY = 0.f;
+                    penetration = r + faceX;
+                } else {
+                    localX = 0.f;
+                    localY = ly < 0.f ? -1.f : 1.f;
+                    penetration = r + faceY;
+                }
+            } else {
+                float ox = lx - clampedX, oy = ly - clampedY;
+                float distanceSq = ox * ox + oy * oy;
+                if (distanceSq >= r * r) {
+                    return false;
+                }
+                float distance = std::sqrt(distanceSq);
+                localX = ox / distance;
+                localY = oy / distance;
+                penetration = r - distance;
+            }
+
+            nx = localX * c - localY * s;
+            ny = localX * s + localY * c;
+            return true;
+        }
+
+    } // namespace
+
+    bool PhysicsModule2d::initialize([[maybe_unused]]const ModuleInput& input) {
+        return true;
+    }
+
+    bool PhysicsModule2d::update(const ModuleInput& input) {
+        {
+            PARTEE_PROFILE_ZONE("Physics::gather");
+            gatherProxies(input.entityManager);
+            integrate(input.dt);
+            updateBounds();
+        }
+        {
+            PARTEE_PROFILE_ZONE("Physics::broadphase");
+            broadphase.findPairs(pairs);
+        }
+        {
+            PARTEE_PROFILE_ZONE("Physics::narrowphase");
+            narrowphase();
+        }
+        {
+            PARTEE_PROFILE_ZONE("Physics::solve");
+            buildIslands();
+            jobs::JobSystem::parallelFor(islandOffsets.size() - 1, IslandsPerBatch, [this](size_t begin, size_t end) {
+                for (size_t island = begin; island < end; ++island) {
+                    solveIsland(island);
+                }
+            });
+        }
+        writeBack(input.dt);
+        if (input.events && !contacts.empty()) {
+            input.events->publish(std::span<const Contact2d>(contacts));
+        }
+        return true;
+    }
+
+    PhysicsModule2d& PhysicsModule2d::setGravity(const Vector2& gravity) {
+        this->gravity = gravity;
+        return *this;
+    }
+
+    PhysicsModule2d& PhysicsModule2d::setSolverIterations(int iterations) {
+        solverIterations = std::max(iterations, 1);
+        return *this;
+    }
+
+    void PhysicsModule2d::gatherProxies(const EntityManager& entityManager) {
+        entities.clear();
+        transforms.clear();
+        colliders.clear();
+        bodies.clear();
+        posX.clear(); posY.clear();
+        velX.clear(); velY.clear();
+        inverseMass.clear(); restitution.clear(); friction.clear();
+        rotation.clear();
+        halfX.clear(); halfY.clear(); radius.clear();
+        shapes.clear();
+        triggers.clear();
+
+        constexpr float degreesToRadians = std::numbers::pi_v<float> / 180.f;
+
+        for (auto& [entity, collider] : entityManager.getEntityComponentPairs<Collider2d>()) {
+            auto* transform = entityManager.getComponent<TransformComponent2d>(entity);
+            if (!transform) {
+                continue;
+            }
+            auto* body = entityManager.getComponent<RigidBody2d>(entity);
+
+            entities.push_back(entity);
+            transforms.push_back(transform);
+            colliders.push_back(&collider);
+            bodies.push_back(body);
+            posX.push_back(transform->transform.position.x + collider.offset.x);
+            posY.push_back(transform->transform.position.y + collider.offset.y);
+            velX.push_back(body ? body->velocity.x : 0.f);
+            velY.push_back(body ? body->velocity.y : 0.f);
+            inverseMass.push_back(body ? body->inverseMass() : 0.f);
+            restitution.push_back(body ? body->restitution : 0.f);
+            friction.push_back(body ? body->friction : 0.5f);
+            rotation.push_back(collider.shape == ColliderShape::OBB ? transform->transform.rotation * degreesToRadians : 0.f);
+            halfX.push_back(collider.halfExtents.x);
+            halfY.push_back(collider.halfExtents.y);
+            radius.push_back(collider.radius);
+            shapes.push_back(collider.shape);
+            triggers.push_back(collider.isTrigger ? 1 : 0);
+        }
+
+        broadphase.setProxyCount(entities.size());
+    }
+
+    void PhysicsModule2d::integrate(float dt) {
+        const size_t count = entities.size();
+        for (size_t i = 0; i < count; ++i) {
+            if (inverseMass[i] > 0.f) {
+                velX[i] += gravity.x * bodies[i]->gravityScale * dt;
+                velY[i] += gravity.y * bodies[i]->gravityScale * dt;
+            }
+        }
+
+        // Static colliders have zero velocity, so every proxy can be advanced unconditionally
+        const simd::Float4 step = simd::set1(dt);
+        size_t i = 0;
+        for (; i + simd::Width <= count; i += simd::Width) {
+            simd::store(&posX[i], simd::load(&posX[i]) + simd::load(&velX[i]) * step);
+            simd::store(&posY[i], simd::load(&posY[i]) + simd::load(&velY[i]) * step);
+        }
+        for (; i < count; ++i) {
+            posX[i] += velX[i] * dt;
+            posY[i] += velY[i] * dt;
+        }
+    }
+
+    void PhysicsModule2d::updateBounds() {
+        for (uint32_t i = 0; i < entities.size(); ++i) {
+            float extentX, extentY;
+            switch (shapes[i]) {
+                case ColliderShape::Circle:
+                    extentX = extentY = radius[i];
+                    break;
+                case ColliderShape::OBB: {
+                    float c = std::fabs(std::cos(rotation[i])), s = std::fabs(std::sin(rotation[i]));
+                    extentX = c * halfX[i] + s * halfY[i];
+                    extentY = s * halfX[i] + c * halfY[i];
+                    break;
+                }
+                default:
+                    extentX = halfX[i];
+                    extentY = halfY[i];
+                    break;
+            }
+            broadphase.setBounds(i, posX[i] - extentX, posY[i] - extentY, posX[i] + extentX, posY[i] + extentY);
+        }
+    }
+
+    void PhysicsModule2d::narrowphase() {
+        proxyContacts.clear();
+        boxPairs.clear();
+        circlePairs.clear();
+
+        for (const auto& [a, b] : pairs) {
+            if (inverseMass[a] == 0.f && inverseMass[b] == 0.f) {
+                continue; // Static and kinematic proxies never respond to each other
+            }
+            if (shapes[a] == ColliderShape::AABB && shapes[b] == ColliderShape::AABB) {
+                boxPairs.emplace_back(a, b);
+            } else if (shapes[a] == ColliderShape::Circle && shapes[b] == ColliderShape::Circle) {
+                circlePairs.emplace_back(a, b);
+            } else {
+                collideGeneric(a, b);
+            }
+        }
+
+        // Box/box and circle/circle pairs are gathered four at a time into SIMD lanes
+        alignas(16) float ax[4], ay[4], ae[4], af[4], bx[4], by[4], be[4], bf[4];
+        alignas(16) float penetration[4], chooseX[4], dx[4], dy[4];
+
+        for (size_t k = 0; k < boxPairs.size(); k += simd::Width) {
+            size_t lanes = std::min<size_t>(simd::Width, boxPairs.size() - k);
+            for (size_t l = 0; l < simd::Width; ++l) {
+                if (l < lanes) {
+                    auto [a, b] = boxPairs[k + l];
+                    ax[l] = posX[a]; ay[l] = posY[a]; ae[l] = halfX[a]; af[l] = halfY[a];
+                    bx[l] = posX[b]; by[l] = posY[b]; be[l] = halfX[b]; bf[l] = halfY[b];
+                } else {
+                    ax[l] = ay[l] = ae[l] = af[l] = be[l] = bf[l] = 0.f;
+                    bx[l] = by[l] = FarAway;
+                }
+            }
+            simd::Float4 deltaX = simd::load(bx) - simd::load(ax);
+            simd::Float4 deltaY = simd::load(by) - simd::load(ay);
+            simd::Float4 overlapX = simd::load(ae) + simd::load(be) - simd::abs(deltaX);
+            simd::Float4 overlapY = simd::load(af) + simd::load(bf) - simd::abs(deltaY);
+            simd::Float4 zero = simd::set1(0.f);
+            int hits = simd::bitmask((overlapX > zero) & (overlapY > zero));
+            if (!hits) {
+                continue;
+            }
+            simd::Mask4 useX = overlapX < overlapY;
+            simd::store(penetration, simd::select(useX, overlapY, overlapX));
+            simd::store(chooseX, simd::select(useX, zero, simd::set1(1.f)));
+            simd::store(dx, deltaX);
+            simd::store(dy, deltaY);
+
+            for (size_t l = 0; l < lanes; ++l) {
+                if (!(hits & (1 << l))) continue;
+                auto [a, b] = boxPairs[k + l];
+                float nx = chooseX[l] != 0.f ? (dx[l] < 0.f ? -1.f : 1.f) : 0.f;
+                float ny = chooseX[l] != 0.f ? 0.f : (dy[l] < 0.f ? -1.f : 1.f);
+                proxyContacts.push_back({a, b, nx, ny, penetration[l], triggers[a] || triggers[b]});
+            }
+        }
+
+        alignas(16) float distance[4];
+        for (size_t k = 0; k < circlePairs.size(); k += simd::Width) {
+            size_t lanes = std::min<size_t>(simd::Width, circlePairs.size() - k);
+            for (size_t l = 0; l < simd::Width; ++l) {
+                if (l < lanes) {
+                    auto [a, b] = circlePairs[k + l];
+                    ax[l] = posX[a]; ay[l] = posY[a]; ae[l] = radius[a];
+                    bx[l] = posX[b]; by[l] = posY[b]; be[l] = radius[b];
+                } else {
+                    ax[l] = ay[l] = ae[l] = be[l] = 0.f;
+                    bx[l] = by[l] = FarAway;
+                }
+            }
+            simd::Float4 deltaX = simd::load(bx) - simd::load(ax);
+            simd::Float4 deltaY = simd::load(by) - simd::load(ay);
+            simd::Float4 radii = simd::load(ae) + simd::load(be);
+            simd::Float4 distanceSq = deltaX * deltaX + deltaY * deltaY;
+            int hits = simd::bitmask(distanceSq < radii * radii);
+            if (!hits) {
+                continue;
+            }
+            simd::Float4 dist = simd::sqrt(distanceSq);
+            simd::store(penetration, radii - dist);
+            simd::store(distance, dist);
+            simd::store(dx, deltaX);
+            simd::store(dy, deltaY);
+
+            for (size_t l = 0; l < lanes; ++l) {
+                if (!(hits & (1 << l))) continue;
+                auto [a, b] = circlePairs[k + l];
+                // Coincident centers have no direction; pick an arbitrary axis
+                float nx = distance[l] > 0.f ? dx[l] / distance[l] : 1.f;
+                float ny = distance[l] > 0.f ? dy[l] / distance[l] : 0.f;
+                proxyContacts.push_back({a, b, nx, ny, penetration[l], triggers[a] || triggers[b]});
+            }
+        }
+    }
+
+    void PhysicsModule2d::collideGeneric(uint32_t a, uint32_t b) {
+        float nx = 0.f, ny = 0.f, penetration = 0.f;
+        bool hit = false;
+        bool aCircle = shapes[a] == ColliderShape::Circle;
+        bool bCircle = shapes[b] == ColliderShape::Circle;
+
+        if (!aCircle && !bCircle) {
+            hit = boxBox(posX[a], posY[a], halfX[a], halfY[a], rotation[a],
+                         posX[b], posY[b], halfX[b], halfY[b], rotation[b], nx, ny, penetration);
+        } else if (aCircle) {
+            hit = circleBox(posX[a], posY[a], radius[a], posX[b], posY[b], halfX[b], halfY[b], rotation[b], nx, ny, penetration);
+            nx = -nx; // circleBox points from the box (b) to the circle (a)
+            ny = -ny;
+        } else {
+            hit = circleBox(posX[b], posY[b], radius[b], posX[a], posY[a], halfX[a], halfY[a], rotation[a], nx, ny, penetration);
+        }
+
+        if (hit) {
+            proxyContacts.push_back({a, b, nx, ny, penetration, triggers[a] || triggers[b]});
+        }
+    }
+
+    void PhysicsModule2d::buildIslands() {
+        const size_t count = entities.size();
+        islandParent.resize(count);
+        std::iota(islandParent.begin(), islandParent.end(), 0u);
+
+        auto find = [this](uint32_t proxy) {
+            while (islandParent[proxy] != proxy) {
+                islandParent[proxy] = islandParent[islandParent[proxy]];
+                proxy = islandParent[proxy];
+            }
+            return proxy;
+        };
+
+        // Only dynamic bodies link islands; static and kinematic proxies are shared read-only
+        for (const auto& contact : proxyContacts) {
+            if (!contact.isTrigger && inverseMass[contact.a] > 0.f && inverseMass[contact.b] > 0.f) {
+                islandParent[find(contact.a)] = find(contact.b);
+            }
+        }
+
+        // Counting sort of contacts by island root
+        std::vector<uint32_t> islandOfRoot(count, UINT32_MAX);
+        std::vector<uint32_t> contactIsland(proxyContacts.size(), UINT32_MAX);
+        islandOffsets.assign(1, 0);
+        for (size_t c = 0; c < proxyContacts.size(); ++c) {
+            const auto& contact = proxyContacts[c];
+            if (contact.isTrigger) continue;
+            uint32_t root = find(inverseMass[contact.a] > 0.f ? contact.a : contact.b);
+            if (islandOfRoot[root] == UINT32_MAX) {
+                islandOfRoot[root] = static_cast<uint32_t>(islandOffsets.size() - 1);
+                islandOffsets.push_back(0);
+            }
+            contactIsland[c] = islandOfRoot[root];
+            ++islandOffsets[islandOfRoot[root] + 1];
+        }
+        std::partial_sum(islandOffsets.begin(), islandOffsets.end(), islandOffsets.begin());
+
+        islandContacts.resize(islandOffsets.back());
+        std::vector<uint32_t> cursor(islandOffsets.begin(), islandOffsets.end() - 1);
+        for (size_t c = 0; c < proxyContacts.size(); ++c) {
+            if (contactIsland[c] != UINT32_MAX) {
+                islandContacts[cursor[contactIsland[c]]++] = static_cast<uint32_t>(c);
+            }
+        }
+    }
+
+    void PhysicsModule2d::solveIsland(size_t island) {
+        const uint32_t begin = islandOffsets[island];
+        const uint32_t end = islandOffsets[island + 1];
+
+        for (int iteration = 0; iteration < solverIterations; ++iteration) {
+            for (uint32_t i = begin; i < end; ++i) {
+                const auto& contact = proxyContacts[islandContacts[i]];
+                const uint32_t a = contact.a, b = contact.b;
+                const float massA = inverseMass[a], massB = inverseMass[b];
+                const float totalInverseMass = massA + massB;
+
+                float relX = velX[b] - velX[a];
+                float relY = velY[b] - velY[a];
+                float normalVelocity = relX * contact.normalX + relY * contact.normalY;
+                if (normalVelocity > 0.f) {
+                    continue; // Already separating
+                }
+
+                float bounce = std::min(restitution[a], restitution[b]);
+                float impulse = -(1.f + bounce) * normalVelocity / totalInverseMass;
+                // Static bodies (inverse mass 0) can sit in several islands solved at once, so they are only read
+                if (massA > 0.f) {
+                    velX[a] -= impulse * contact.normalX * massA;
+                    velY[a] -= impulse * contact.normalY * massA;
+                }
+                if (massB > 0.f) {
+                    velX[b] += impulse * contact.normalX * massB;
+                    velY[b] += impulse * contact.normalY * massB;
+                }
+
+                // Coulomb friction along the contact tangent
+                relX = velX[b] - velX[a];
+                relY = velY[b] - velY[a];
+                float tangentX = relX - (relX * contact.normalX + relY * contact.normalY) * contact.normalX;
+                float tangentY = relY - (relX * contact.normalX + relY * contact.normalY) * contact.normalY;
+                float tangentLength = std::sqrt(tangentX * tangentX + tangentY * tangentY);
+                if (tangentLength > 1e-6f) {
+                    tangentX /= tangentLength;
+                    tangentY /= tangentLength;
+                    float mu = std::sqrt(friction[a] * friction[b]);
+                    float frictionImpulse = std::clamp(-(relX * tangentX + relY * tangentY) / totalInverseMass, -impulse * mu, impulse * mu);
+                    if (massA > 0.f) {
+                        velX[a] -= frictionImpulse * tangentX * massA;
+                        velY[a] -= frictionImpulse * tangentY * massA;
+                    }
+                    if (massB > 0.f) {
+                        velX[b] += frictionImpulse * tangentX * massB;
+                        velY[b] += frictionImpulse * tangentY * massB;
+                    }
+                }
+            }
+        }
+
+        for (uint32_t i = begin; i < end; ++i) {
+            const auto& contact = proxyContacts[islandContacts[i]];
+            const uint32_t a = contact.a, b = contact.b;
+            const float totalInverseMass = inverseMass[a] + inverseMass[b];
+            float correction = std::max(contact.penetration - PenetrationSlop, 0.f) / totalInverseMass * CorrectionPercent;
+            if (inverseMass[a] > 0.f) {
+                posX[a] -= contact.normalX * correction * inverseMass[a];
+                posY[a] -= contact.normalY * correction * inverseMass[a];
+            }
+            if (inverseMass[b] > 0.f) {
+                posX[b] += contact.normalX * correction * inverseMass[b];
+                posY[b] += contact.normalY * correction * inverseMass[b];
+            }
+        }
+    }
+
+    void PhysicsModule2d::writeBack(float dt) {
+        contacts.clear();
+        contacts.reserve(proxyContacts.size());
+        for (const auto& contact : proxyContacts) {
+            contacts.push_back(Contact2d{
+                entities[contact.a],
+                entities[contact.b],
+                Vector2(contact.normalX, contact.normalY),
+                contact.penetration,
+                contact.isTrigger
+            });
+        }
+
+        for (size_t i = 0; i < entities.size(); ++i) {
+            RigidBody2d* body = bodies[i];
+            if (!body) {
+                continue; // Static colliders never move
+            }
+            Transform2d& transform = transforms[i]->transform;
+            // Proxy positions include the collider offset
+            transform.position = Vector2(posX[i] - colliders[i]->offset.x, posY[i] - colliders[i]->offset.y);
+            body->velocity = Vector2(velX[i], velY[i]);
+            transform.rotation += body->angularVelocity * dt;
+        }
+    }
+
+} // namespace parteeengine::physics
@@ -0,0 +1,86 @@
+#include "engine/physics/SweepAndPrune2d.hpp"
+
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <numeric>
+
+namespace parteeengine::physics {
+
+    void SweepAndPrune2d::setProxyCount(size_t count) {
+        if (count != minX.size()) {
+            orderValid = false;
+        }
+        minX.resize(count);
+        minY.resize(count);
+        maxX.resize(count);
+        maxY.resize(count);
+    }
+
+    void SweepAndPrune2d::sortAxis() {
+        if (!orderValid) {
+            order.resize(minX.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return minX[a] < minX[b]; });
+            orderValid = true;
+            return;
+        }
+
+        // Insertion sort: the previous order is nearly sorted, so this is O(n + swaps)
+        for (size_t i = 1; i < order.size(); ++i) {
+            uint32_t proxy = order[i];
+            float key = minX[proxy];
+            size_t j = i;
+            while (j > 0 && minX[order[j - 1]] > key) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = proxy;
+        }
+    }
+
+    void SweepAndPrune2d::findPairs(std::vector<ProxyPair>& pairs) {
+        pairs.clear();
+        sortAxis();
+
+        const size_t count = order.size();
+        const size_t padded = count + simd::Width;
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        sortedMinX.assign(padded, inf);
+        sortedMinY.assign(padded, inf);
+        sortedMaxY.assign(padded, -inf);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t proxy = order[i];
+            sortedMinX[i] = minX[proxy];
+            sortedMinY[i] = minY[proxy];
+            sortedMaxY[i] = maxY[proxy];
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t proxy = order[i];
+            simd::Float4 limitX = simd::set1(maxX[proxy]);
+            simd::Float4 lowY = simd::set1(minY[proxy]);
+            simd::Float4 highY = simd::set1(maxY[proxy]);
+
+            // Candidates are sorted by minX, so lanes passing the x test form a prefix
+            for (size_t j = i + 1; j < count; j += simd::Width) {
+                int xMask = simd::bitmask(simd::load(&sortedMinX[j]) <= limitX);
+                if (xMask == 0) {
+                    break;
+                }
+                int hits = xMask & simd::bitmask((simd::load(&sortedMinY[j]) <= highY) & (simd::load(&sortedMaxY[j]) >= lowY));
+                while (hits) {
+                    int lane = std::countr_zero(static_cast<unsigned>(hits));
+                    pairs.emplace_back(proxy, order[j + lane]);
+                    hits &= hits - 1;
+                }
+                if (xMask != 0xF) {
+                    break;
+                }
+            }
+        }
+    }
+
+} // namespace parteeengine::physics
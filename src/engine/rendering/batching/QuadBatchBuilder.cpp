@@ -0,0 +1,136 @@
+#include "engine/rendering/batching/QuadBatchBuilder.hpp"
+
+#include "engine/core/jobs/JobSystem.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+#include <numbers>
+
+namespace parteeengine::rendering {
+
+    namespace {
+
+        constexpr size_t QuadsPerJob = 4096;
+        constexpr float DegreesToRadians = std::numbers::pi_v<float> / 180.f;
+
+    } // namespace
+
+    void QuadBatchBuilder::build(std::span<const QuadRenderCommand> commands) {
+        PARTEE_PROFILE_ZONE("QuadBatchBuilder::build");
+        vertices.resize(commands.size() * 4);
+        batches.clear();
+        if (commands.empty()) {
+            return;
+        }
+
+        // Batches only depend on state, so split them up front in one cheap pass
+        QuadBatch current{0, 0, commands[0].texture};
+        for (size_t i = 0; i < commands.size(); ++i) {
+            if (commands[i].texture != current.texture || current.quadCount == maxQuadsPerBatch) {
+                batches.push_back(current);
+                current = {static_cast<uint32_t>(i), 0, commands[i].texture};
+            }
+            ++current.quadCount;
+        }
+        batches.push_back(current);
+
+        uint32_t largest = 0;
+        for (const auto& batch : batches) {
+            largest = std::max(largest, batch.quadCount);
+        }
+        ensureIndices(largest);
+
+        if (threaded) {
+            jobs::JobSystem::parallelFor(commands.size(), QuadsPerJob, [this, commands](size_t begin, size_t end) {
+                transform(commands, begin, end);
+            });
+        } else {
+            transform(commands, 0, commands.size());
+        }
+    }
+
+    QuadBatchBuilder& QuadBatchBuilder::setMaxQuadsPerBatch(uint32_t quads) {
+        maxQuadsPerBatch = std::clamp<uint32_t>(quads, 1, MaxQuadsPerBatch);
+        return *this;
+    }
+
+    QuadBatchBuilder& QuadBatchBuilder::setThreaded(bool threaded) {
+        this->threaded = threaded;
+        return *this;
+    }
+
+    uint32_t QuadBatchBuilder::packColor(const Color& color) {
+        auto channel = [](float value) {
+            return static_cast<uint32_t>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+        };
+        return channel(color.r) | (channel(color.g) << 8) | (channel(color.b) << 16) | (channel(color.a) << 24);
+    }
+
+    void QuadBatchBuilder::transform(std::span<const QuadRenderCommand> commands, size_t begin, size_t end) {
+        using namespace simd;
+
+        for (size_t base = begin; base < end; base += Width) {
+            const size_t lanes = std::min<size_t>(Width, end - base);
+
+            // Gather one group of quads into lanes; unused tail lanes stay zero
+            alignas(16) float posX[Width] = {}, posY[Width] = {}, angle[Width] = {}, scaleX[Width] = {}, scaleY[Width] = {};
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                const Transform2d& t = commands[base + lane].transform;
+                posX[lane] = t.position.x;
+                posY[lane] = t.position.y;
+                angle[lane] = t.rotation * DegreesToRadians;
+                scaleX[lane] = t.scale.x;
+                scaleY[lane] = t.scale.y;
+            }
+
+            Float4 sine, cosine;
+            sinCos(load(angle), sine, cosine);
+            Float4 halfX = load(scaleX) * set1(0.5f);
+            Float4 halfY = load(scaleY) * set1(0.5f);
+
+            // Rotated half axes: a along the quad's x, b along its y
+            Float4 ax = halfX * cosine, ay = halfX * sine;
+            Float4 bx = set1(0.f) - halfY * sine, by = halfY * cosine;
+            Float4 px = load(posX), py = load(posY);
+
+            // Corners (-a-b), (+a-b), (+a+b), (-a+b)
+            alignas(16) float cornerX[4][Width], cornerY[4][Width];
+            store(cornerX[0], px - ax - bx); store(cornerY[0], py - ay - by);
+            store(cornerX[1], px + ax - bx); store(cornerY[1], py + ay - by);
+            store(cornerX[2], px + ax + bx); store(cornerY[2], py + ay + by);
+            store(cornerX[3], px - ax + bx); store(cornerY[3], py - ay + by);
+
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                const QuadRenderCommand& command = commands[base + lane];
+                const uint32_t color = packColor(command.color);
+                // Texture corners in the winding the index pattern expects
+                const float cornerU[4] = {command.uv.u0, command.uv.u1, command.uv.u1, command.uv.u0};
+                const float cornerV[4] = {command.uv.v0, command.uv.v0, command.uv.v1, command.uv.v1};
+                QuadVertex* out = &vertices[(base + lane) * 4];
+                for (int corner = 0; corner < 4; ++corner) {
+                    out[corner] = {cornerX[corner][lane], cornerY[corner][lane], cornerU[corner], cornerV[corner], color};
+                }
+            }
+        }
+    }
+
+    void QuadBatchBuilder::ensureIndices(uint32_t quads) {
+        size_t built = indices.size() / 6;
+        if (built >= quads) {
+            return;
+        }
+        indices.resize(size_t(quads) * 6);
+        for (size_t quad = built; quad < quads; ++quad) {
+            size_t first = quad * 4;
+            uint16_t* out = &indices[quad * 6];
+            out[0] = static_cast<uint16_t>(first);
+            out[1] = static_cast<uint16_t>(first + 1);
+            out[2] = static_cast<uint16_t>(first + 2);
+            out[3] = static_cast<uint16_t>(first + 2);
+            out[4] = static_cast<uint16_t>(first + 3);
+            out[5] = static_cast<uint16_t>(first);
+        }
+    }
+
+} // namespace parteeengine::rendering
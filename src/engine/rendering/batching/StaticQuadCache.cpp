@@ -0,0 +1,138 @@
+#include "engine/rendering/batching/StaticQuadCache.hpp"
+
+#include "engine/core/entities/EntityManager.hpp"
+#include "engine/rendering/renderables/RenderQuad.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace parteeengine::rendering {
+
+    bool StaticQuadCache::update(const EntityManager& entityManager) {
+        if (!built
+            || entityManager.getComponentVersion<RenderQuadComponent>() != quadVersion
+            || entityManager.getComponentVersion<TransformComponent2d>() != transformVersion) {
+            rebuild(entityManager);
+            return true;
+        }
+
+        // Component pointers are stable until the versions change, so each entry is checked in place.
+        // A changed quad marks the batch it leaves and the one it joins; the batches are refilled after.
+        bool batchesChanged = false;
+        bool dynamicChanged = false;
+        for (Entry& entry : entries) {
+            const RenderQuadComponent& quad = *entry.component;
+            if (entry.batch == Dynamic) {
+                if (!quad.isStatic) {
+                    continue;
+                }
+                dynamicChanged = true;
+            } else {
+                const StaticQuadBatch& batch = batches[entry.batch];
+                const QuadRenderCommand& baked = batch.quads[entry.slot];
+                // Bytes rather than values, so a NaN that was baked doesn't count as a change every frame
+                if (quad.isStatic
+                    && std::memcmp(&baked.transform, entry.transform, sizeof(Transform2d)) == 0
+                    && std::memcmp(&baked.color, &quad.color, sizeof(Color)) == 0
+                    && RenderQuadComponent::sortKey(quad) == batch.sortKey) {
+                    continue;
+                }
+                dirtyBatches[entry.batch] = 1;
+                dynamicChanged |= !quad.isStatic;
+            }
+            entry.batch = quad.isStatic ? batchFor(quad, *entry.transform) : Dynamic;
+            if (entry.batch != Dynamic) {
+                dirtyBatches[entry.batch] = 1;
+            }
+            batchesChanged = true;
+        }
+        if (batchesChanged) {
+            batchRebuildCount += rebuildDirtyBatches();
+        }
+        if (dynamicChanged) {
+            rebuildDynamicQuads();
+        }
+        return batchesChanged;
+    }
+
+    void StaticQuadCache::rebuild(const EntityManager& entityManager) {
+        quadVersion = entityManager.getComponentVersion<RenderQuadComponent>();
+        transformVersion = entityManager.getComponentVersion<TransformComponent2d>();
+        built = true;
+        ++rebuildCount;
+
+        entries.clear();
+        batches.clear();
+        dirtyBatches.clear();
+        batchIndices.clear();
+        for (const auto& [entity, quad] : entityManager.getEntityComponentPairs<RenderQuadComponent>()) {
+            const TransformComponent2d* transformComponent = entityManager.getComponent<TransformComponent2d>(entity);
+            if (!transformComponent) {
+                continue;
+            }
+            const Transform2d& transform = transformComponent->transform;
+            entries.push_back(Entry{&quad, &transform, quad.isStatic ? batchFor(quad, transform) : Dynamic, 0});
+        }
+        rebuildDirtyBatches();
+        rebuildDynamicQuads();
+    }
+
+    uint32_t StaticQuadCache::batchFor(const RenderQuadComponent& quad, const Transform2d& transform) {
+        const uint64_t sortKey = RenderQuadComponent::sortKey(quad);
+        const auto cellX = static_cast<int64_t>(std::floor(transform.position.x / CellSize));
+        const auto cellY = static_cast<int64_t>(std::floor(transform.position.y / CellSize));
+        auto [it, inserted] = batchIndices.try_emplace(std::make_tuple(sortKey, cellX, cellY), static_cast<uint32_t>(batches.size()));
+        if (inserted) {
+            batches.emplace_back().sortKey = sortKey;
+            dirtyBatches.push_back(1);
+        }
+        return it->second;
+    }
+
+    size_t StaticQuadCache::rebuildDirtyBatches() {
+        for (size_t b = 0; b < batches.size(); ++b) {
+            if (dirtyBatches[b]) {
+                batches[b].quads.clear();
+                batches[b].bounds = CullBounds{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                                               std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+            }
+        }
+        for (Entry& entry : entries) {
+            if (entry.batch == Dynamic || !dirtyBatches[entry.batch]) {
+                continue;
+            }
+            const Transform2d& transform = *entry.transform;
+            StaticQuadBatch& batch = batches[entry.batch];
+            entry.slot = static_cast<uint32_t>(batch.quads.size());
+            batch.quads.push_back(QuadRenderCommand{transform, entry.component->color, 0, {}});
+
+            // Bounding circle of the quad, so rotation never pokes out of the bounds
+            const float radius = 0.5f * std::hypot(transform.scale.x, transform.scale.y);
+            batch.bounds.minX = std::min(batch.bounds.minX, transform.position.x - radius);
+            batch.bounds.minY = std::min(batch.bounds.minY, transform.position.y - radius);
+            batch.bounds.maxX = std::max(batch.bounds.maxX, transform.position.x + radius);
+            batch.bounds.maxY = std::max(batch.bounds.maxY, transform.position.y + radius);
+        }
+        size_t rebuilt = 0;
+        for (size_t b = 0; b < batches.size(); ++b) {
+            if (dirtyBatches[b]) {
+                batches[b].version = nextBatchVersion.fetch_add(1, std::memory_order_relaxed);
+                dirtyBatches[b] = 0;
+                ++rebuilt;
+            }
+        }
+        return rebuilt;
+    }
+
+    void StaticQuadCache::rebuildDynamicQuads() {
+        dynamicQuads.clear();
+        for (const Entry& entry : entries) {
+            if (entry.batch == Dynamic) {
+                dynamicQuads.push_back(DynamicQuad{entry.component, entry.transform});
+            }
+        }
+    }
+
+} // namespace parteeengine::rendering
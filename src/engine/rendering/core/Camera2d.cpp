@@ -0,0 +1,46 @@
+#include "engine/rendering/core/Camera2d.hpp"
+
+#include "engine/util/Mat3.hpp"
+#include "engine/util/Mat4.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace parteeengine::rendering {
+
+    RenderView RenderView::fromCamera(const Camera2d& camera, int windowWidth, int windowHeight) {
+        RenderView result;
+        result.x = static_cast<int>(std::lround(camera.viewport.x * static_cast<float>(windowWidth)));
+        result.y = static_cast<int>(std::lround(camera.viewport.y * static_cast<float>(windowHeight)));
+        result.width = std::max(static_cast<int>(std::lround(camera.viewport.width * static_cast<float>(windowWidth))), 1);
+        result.height = std::max(static_cast<int>(std::lround(camera.viewport.height * static_cast<float>(windowHeight))), 1);
+
+        // pixel = zoom * rotate(-rotation) * (world - position) + viewport center
+        const float zoom = camera.zoom > 0.f ? camera.zoom : 1.f;
+        const float centerX = 0.5f * static_cast<float>(result.width);
+        const float centerY = 0.5f * static_cast<float>(result.height);
+        const Vector2& p = camera.position;
+        const Mat3 view = Mat3::translation(Vector2(centerX, centerY)) * Mat3::rotation(-camera.rotation)
+            * Mat3::scale(Vector2(zoom, zoom)) * Mat3::translation(Vector2(-p.x, -p.y));
+        const Mat4 view4 = view.toMat4();
+        std::copy(view4.data(), view4.data() + 16, result.view);
+
+        // World-space box around the rotated viewport
+        const float halfWidth = centerX / zoom;
+        const float halfHeight = centerY / zoom;
+        const float radians = camera.rotation * std::numbers::pi_v<float> / 180.f;
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        const float extentX = std::abs(c) * halfWidth + std::abs(s) * halfHeight;
+        const float extentY = std::abs(s) * halfWidth + std::abs(c) * halfHeight;
+        result.visible = CullBounds{p.x - extentX, p.y - extentY, p.x + extentX, p.y + extentY};
+        return result;
+    }
+
+    RenderView RenderView::screen(int windowWidth, int windowHeight) {
+        Camera2d camera(Vector2(0.5f * static_cast<float>(windowWidth), 0.5f * static_cast<float>(windowHeight)));
+        return fromCamera(camera, windowWidth, windowHeight);
+    }
+
+} // namespace parteeengine::rendering
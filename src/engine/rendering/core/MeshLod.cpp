@@ -0,0 +1,82 @@
+#include "engine/rendering/core/MeshLod.hpp"
+
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace parteeengine::rendering {
+
+    MeshLodChain& MeshLodChain::addLevel(assets::AssetHandle<assets::Mesh> mesh, float screenSize) {
+        if (levels.size() == MaxLevels) {
+            std::cerr << "MeshLodChain: more than " << MaxLevels << " levels, ignoring " << mesh.getPath() << "\n";
+            return *this;
+        }
+        if (!levels.empty()) {
+            screenSizes.push_back(screenSize);
+        }
+        levels.push_back(std::move(mesh));
+        return *this;
+    }
+
+    MeshLodChain& MeshLodChain::setHysteresis(float fraction) {
+        hysteresis = std::clamp(fraction, 0.f, 0.9f);
+        return *this;
+    }
+
+    const assets::Mesh* MeshLodChain::resolve(uint8_t level, uint8_t& drawn) const {
+        const size_t count = levels.size();
+        for (size_t i = level; i < count; ++i) {
+            if (const assets::Mesh* mesh = levels[i].get()) {
+                drawn = static_cast<uint8_t>(i);
+                return mesh;
+            }
+        }
+        for (size_t i = std::min<size_t>(level, count); i-- > 0;) {
+            if (const assets::Mesh* mesh = levels[i].get()) {
+                drawn = static_cast<uint8_t>(i);
+                return mesh;
+            }
+        }
+        return nullptr;
+    }
+
+    void selectLods(const MeshLodChain& chain, float pixelsPerUnit, const float* halfX, const float* halfY,
+                    float* levels, size_t count) {
+        // The level is the number of thresholds the size is under. Each threshold is raised
+        // for instances already past it and lowered for the rest, which is the hysteresis.
+        const size_t thresholdCount = std::min(chain.screenSizes.size(), chain.levels.empty() ? 0 : chain.levels.size() - 1);
+        const float up = 1.f + chain.hysteresis;
+        const float down = 1.f - chain.hysteresis;
+        const float diameter = 2.f * pixelsPerUnit;
+
+        size_t i = 0;
+        const simd::Float4 diameter4 = simd::set1(diameter);
+        const simd::Float4 one = simd::set1(1.f);
+        const simd::Float4 zero = simd::set1(0.f);
+        for (; i + simd::Width <= count; i += simd::Width) {
+            const simd::Float4 hx = simd::load(halfX + i);
+            const simd::Float4 hy = simd::load(halfY + i);
+            const simd::Float4 size = simd::sqrt(hx * hx + hy * hy) * diameter4;
+            const simd::Float4 previous = simd::load(levels + i);
+            simd::Float4 level = zero;
+            for (size_t t = 0; t < thresholdCount; ++t) {
+                const simd::Mask4 past = previous > simd::set1(static_cast<float>(t));
+                const simd::Float4 threshold = simd::select(past, simd::set1(chain.screenSizes[t] * down), simd::set1(chain.screenSizes[t] * up));
+                level = level + simd::select(size < threshold, zero, one);
+            }
+            simd::store(levels + i, level);
+        }
+        for (; i < count; ++i) {
+            const float size = std::sqrt(halfX[i] * halfX[i] + halfY[i] * halfY[i]) * diameter;
+            float level = 0.f;
+            for (size_t t = 0; t < thresholdCount; ++t) {
+                const float threshold = chain.screenSizes[t] * (levels[i] > static_cast<float>(t) ? up : down);
+                level += size < threshold ? 1.f : 0.f;
+            }
+            levels[i] = level;
+        }
+    }
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,57 @@
+#include "engine/rendering/core/RenderFrame.hpp"
+
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/util/RadixSort.hpp"
+
+namespace parteeengine::rendering {
+
+    void RenderFrame::sort() {
+        PARTEE_PROFILE_ZONE("RenderFrame::sort");
+        entries.clear();
+        for (size_t b = 0; b < buckets.size(); ++b) {
+            std::span<const uint64_t> keys = buckets[b]->getKeys();
+            for (size_t i = 0; i < keys.size(); ++i) {
+                entries.push_back(SortEntry{keys[i], static_cast<uint32_t>(b), static_cast<uint32_t>(i)});
+            }
+        }
+        scratch.resize(entries.size());
+        radixSort<SortEntry>(entries, scratch, [](const SortEntry& entry) { return entry.key; });
+
+        orders.resize(buckets.size());
+        for (auto& order : orders) {
+            order.clear();
+        }
+        runs.clear();
+        for (const SortEntry& entry : entries) {
+            std::vector<uint32_t>& order = orders[entry.bucket];
+            if (runs.empty() || runs.back().bucket != entry.bucket) {
+                runs.push_back(RenderRun{entry.bucket, static_cast<uint32_t>(order.size()), 0});
+            }
+            order.push_back(entry.index);
+            ++runs.back().count;
+        }
+
+        for (size_t b = 0; b < buckets.size(); ++b) {
+            const std::vector<uint32_t>& order = orders[b];
+            bool inOrder = true;
+            for (size_t i = 0; i < order.size() && inOrder; ++i) {
+                inOrder = order[i] == i;
+            }
+            if (!inOrder) {
+                buckets[b]->reorder(order);
+            }
+        }
+    }
+
+    void RenderFrame::clear() {
+        for (auto& bucket : buckets) {
+            bucket->reset();
+        }
+        arena.reset();
+        for (auto& partition : partitions) {
+            partition->clear();
+        }
+        runs.clear();
+    }
+
+} // namespace parteeengine::rendering
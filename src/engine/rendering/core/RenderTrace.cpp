@@ -0,0 +1,349 @@
+#include "engine/rendering/core/RenderTrace.hpp"
+
+#include "engine/assets/Mesh.hpp"
+#include "engine/particles/ParticlePool.hpp"
+#include "engine/rendering/batching/StaticQuadCache.hpp"
+
+#include <algorithm>
+
+namespace parteeengine::rendering {
+
+    template<typename T>
+    static void writeValue(std::ofstream& file, const T& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    static bool readValue(std::ifstream& file, T& value) {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    static bool readBytes(std::ifstream& file, void* data, size_t size) {
+        return static_cast<bool>(file.read(static_cast<char*>(data), static_cast<std::streamsize>(size)));
+    }
+
+    bool RenderTraceWriter::open(const std::string& filePath) {
+        close();
+        file.open(filePath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(trace::Magic, sizeof(trace::Magic));
+        writeValue(file, trace::Version);
+        writeValue(file, static_cast<uint32_t>(sizeof(RenderView)));
+        return file.good();
+    }
+
+    void RenderTraceWriter::close() {
+        if (file.is_open()) {
+            file.close();
+        }
+        // Records are per file; registrations stay
+        for (auto& [type, entry] : types) {
+            entry.index = -1;
+        }
+        typeCount = 0;
+        meshes.clear();
+        meshCount = 0;
+        quadBatches.clear();
+        quadBatchCount = 0;
+        particleCount = 0;
+        frameCount = 0;
+    }
+
+    void RenderTraceWriter::writeFrame(const RenderFrame& frame, int width, int height) {
+        if (!file.is_open()) {
+            return;
+        }
+
+        frameBytes.clear();
+        particleCount = 0;
+        append(static_cast<int32_t>(width));
+        append(static_cast<int32_t>(height));
+        append(frame.getView());
+        const size_t bucketCountOffset = frameBytes.size();
+        uint16_t bucketCount = 0;
+        append(bucketCount);
+
+        for (const auto& bucket : frame.getBuckets()) {
+            auto it = types.find(bucket->getType());
+            if (it == types.end() || bucket->size() == 0) {
+                continue;
+            }
+            TypeEntry& entry = it->second;
+            // Type records must precede the frame that references them
+            if (entry.index < 0) {
+                entry.index = typeCount++;
+                const std::string_view name = entry.name;
+                const uint16_t length = static_cast<uint16_t>(std::min<size_t>(name.size(), UINT16_MAX));
+                writeValue(file, trace::TypeRecord);
+                writeValue(file, length);
+                file.write(name.data(), length);
+                writeValue(file, entry.commandSize);
+            }
+
+            append(static_cast<uint16_t>(entry.index));
+            append(static_cast<uint32_t>(bucket->size()));
+            append(bucket->getKeys().data(), bucket->getKeys().size_bytes());
+            entry.encode(*bucket, *this); // May write mesh records
+            ++bucketCount;
+        }
+        std::memcpy(frameBytes.data() + bucketCountOffset, &bucketCount, sizeof(bucketCount));
+
+        writeValue(file, trace::FrameRecord);
+        file.write(reinterpret_cast<const char*>(frameBytes.data()), static_cast<std::streamsize>(frameBytes.size()));
+        ++frameCount;
+    }
+
+    uint32_t RenderTraceWriter::addMesh(const assets::Mesh& mesh) {
+        // Mesh ids are never reused, unlike addresses, so a reloaded mesh always gets a record of its own
+        auto [it, inserted] = meshes.try_emplace(mesh.id, meshCount);
+        if (!inserted) {
+            return it->second;
+        }
+        const uint32_t id = meshCount++;
+
+        writeValue(file, trace::MeshRecord);
+        writeValue(file, static_cast<uint32_t>(mesh.vertices.size()));
+        writeValue(file, static_cast<uint32_t>(mesh.indices.size()));
+        writeValue(file, static_cast<uint32_t>(mesh.submeshes.size()));
+        writeValue(file, mesh.boundsMin);
+        writeValue(file, mesh.boundsMax);
+        file.write(reinterpret_cast<const char*>(mesh.vertices.data()), static_cast<std::streamsize>(mesh.vertices.size() * sizeof(assets::MeshVertex)));
+        file.write(reinterpret_cast<const char*>(mesh.indices.data()), static_cast<std::streamsize>(mesh.indices.size() * sizeof(uint32_t)));
+        for (const assets::Submesh& submesh : mesh.submeshes) {
+            writeValue(file, submesh.indexOffset);
+            writeValue(file, submesh.indexCount);
+        }
+        return id;
+    }
+
+    void RenderTraceWriter::append(const void* data, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        const size_t offset = frameBytes.size();
+        frameBytes.resize(offset + size);
+        std::memcpy(frameBytes.data() + offset, data, size);
+    }
+
+    uint32_t RenderTraceWriter::addQuadBatch(const StaticQuadBatch& batch) {
+        auto it = quadBatches.find(&batch);
+        if (it != quadBatches.end() && it->second.version == batch.version) {
+            return it->second.id;
+        }
+        const uint32_t id = quadBatchCount++;
+        quadBatches.insert_or_assign(&batch, QuadBatchEntry{id, batch.version});
+
+        writeValue(file, trace::QuadBatchRecord);
+        writeValue(file, batch.sortKey);
+        writeValue(file, batch.version);
+        writeValue(file, batch.bounds);
+        writeValue(file, static_cast<uint32_t>(batch.quads.size()));
+        file.write(reinterpret_cast<const char*>(batch.quads.data()), static_cast<std::streamsize>(batch.quads.size() * sizeof(QuadRenderCommand)));
+        return id;
+    }
+
+    uint32_t RenderTraceWriter::addParticles(const particles::ParticlePool& pool, size_t count) {
+        const uint32_t id = particleCount++;
+        const auto writeArray = [&](const std::unique_ptr<float[]>& values) {
+            file.write(reinterpret_cast<const char*>(values.get()), static_cast<std::streamsize>(count * sizeof(float)));
+        };
+        writeValue(file, trace::ParticleRecord);
+        writeValue(file, static_cast<uint32_t>(count));
+        writeArray(pool.posX);
+        writeArray(pool.posY);
+        writeArray(pool.r);
+        writeArray(pool.g);
+        writeArray(pool.b);
+        writeArray(pool.a);
+        return id;
+    }
+
+    RenderTraceReader::RenderTraceReader() = default;
+    RenderTraceReader::~RenderTraceReader() = default;
+
+    bool RenderTraceReader::open(const std::string& filePath) {
+        close();
+        file.open(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.seekg(0, std::ios::end);
+        fileSize = static_cast<uint64_t>(file.tellg());
+        file.seekg(0, std::ios::beg);
+
+        char magic[sizeof(trace::Magic)];
+        uint32_t version = 0;
+        uint32_t viewSize = 0;
+        if (!file.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), trace::Magic)
+            || !readValue(file, version) || version != trace::Version
+            || !readValue(file, viewSize) || viewSize != sizeof(RenderView)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void RenderTraceReader::close() {
+        if (file.is_open()) {
+            file.close();
+        }
+        traceTypes.clear();
+        meshes.clear();
+        quadBatches.clear();
+        particlePools.clear();
+        skippedCommands = 0;
+        fileSize = 0;
+    }
+
+    uint64_t RenderTraceReader::remainingBytes() {
+        const std::streamoff position = file.tellg();
+        return position < 0 || static_cast<uint64_t>(position) > fileSize ? 0 : fileSize - static_cast<uint64_t>(position);
+    }
+
+    bool RenderTraceReader::nextFrame(RenderFrame& frame, int& width, int& height) {
+        // The previous frame's particles are done with; this frame's records follow
+        particlePools.clear();
+        uint8_t tag = 0;
+        while (readValue(file, tag)) {
+            if (tag == trace::TypeRecord) {
+                uint16_t length = 0;
+                if (!readValue(file, length)) return false;
+                std::string name(length, '\0');
+                uint32_t commandSize = 0;
+                if (!readBytes(file, name.data(), length) || !readValue(file, commandSize)) return false;
+                auto it = registered.find(name);
+                const TypeEntry* entry = it != registered.end() && it->second.commandSize == commandSize ? &it->second : nullptr;
+                traceTypes.push_back(TraceType{entry, commandSize});
+            } else if (tag == trace::MeshRecord) {
+                if (!readMesh()) return false;
+            } else if (tag == trace::QuadBatchRecord) {
+                if (!readQuadBatch()) return false;
+            } else if (tag == trace::ParticleRecord) {
+                if (!readParticles()) return false;
+            } else if (tag == trace::FrameRecord) {
+                int32_t frameWidth = 0, frameHeight = 0;
+                RenderView view;
+                uint16_t bucketCount = 0;
+                if (!readValue(file, frameWidth) || !readValue(file, frameHeight) || !readValue(file, view) || !readValue(file, bucketCount)) {
+                    return false;
+                }
+                frame.clear();
+                frame.setView(view);
+                width = frameWidth;
+                height = frameHeight;
+
+                for (uint16_t b = 0; b < bucketCount; ++b) {
+                    uint16_t type = 0;
+                    uint32_t count = 0;
+                    if (!readValue(file, type) || !readValue(file, count) || type >= traceTypes.size()) {
+                        return false;
+                    }
+                    const TraceType& traceType = traceTypes[type];
+                    // Every command is a key and its bytes; a count the rest of the file can't hold is corrupt
+                    if (count > remainingBytes() / (sizeof(uint64_t) + uint64_t(traceType.commandSize))) {
+                        return false;
+                    }
+                    keys.resize(count);
+                    commandBytes.resize(size_t(count) * traceType.commandSize);
+                    if (!readBytes(file, keys.data(), keys.size() * sizeof(uint64_t)) || !readBytes(file, commandBytes.data(), commandBytes.size())) {
+                        return false;
+                    }
+                    if (!traceType.entry) {
+                        skippedCommands += count;
+                        continue;
+                    }
+                    if (!traceType.entry->decode(frame, commandBytes.data(), keys.data(), count, *this)) {
+                        return false;
+                    }
+                }
+                return true;
+            } else {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    const assets::Mesh* RenderTraceReader::getMesh(uint32_t id) const {
+        return id < meshes.size() ? meshes[id].get() : nullptr;
+    }
+
+    const StaticQuadBatch* RenderTraceReader::getQuadBatch(uint32_t id) const {
+        return id < quadBatches.size() ? quadBatches[id].get() : nullptr;
+    }
+
+    const particles::ParticlePool* RenderTraceReader::getParticles(uint32_t id) const {
+        return id < particlePools.size() ? particlePools[id].get() : nullptr;
+    }
+
+    bool RenderTraceReader::readMesh() {
+        uint32_t vertexCount = 0, indexCount = 0, submeshCount = 0;
+        auto mesh = std::make_unique<assets::Mesh>();
+        if (!readValue(file, vertexCount) || !readValue(file, indexCount) || !readValue(file, submeshCount)
+            || !readValue(file, mesh->boundsMin) || !readValue(file, mesh->boundsMax)) {
+            return false;
+        }
+        // Counts are checked against the rest of the file before anything is allocated; no product overflows 64 bits
+        if (uint64_t(vertexCount) * sizeof(assets::MeshVertex) + uint64_t(indexCount) * sizeof(uint32_t)
+            + uint64_t(submeshCount) * 2 * sizeof(uint32_t) > remainingBytes()) {
+            return false;
+        }
+        mesh->vertices.resize(vertexCount);
+        mesh->indices.resize(indexCount);
+        mesh->submeshes.resize(submeshCount);
+        if (!readBytes(file, mesh->vertices.data(), size_t(vertexCount) * sizeof(assets::MeshVertex))
+            || !readBytes(file, mesh->indices.data(), size_t(indexCount) * sizeof(uint32_t))) {
+            return false;
+        }
+        // Ranges and indices are validated like MeshCache::view does, so renderers can trust them
+        for (assets::Submesh& submesh : mesh->submeshes) {
+            if (!readValue(file, submesh.indexOffset) || !readValue(file, submesh.indexCount)
+                || uint64_t(submesh.indexOffset) + submesh.indexCount > indexCount) {
+                return false;
+            }
+        }
+        for (uint32_t index : mesh->indices) {
+            if (index >= vertexCount) {
+                return false;
+            }
+        }
+        meshes.push_back(std::move(mesh));
+        return true;
+    }
+
+    bool RenderTraceReader::readQuadBatch() {
+        auto batch = std::make_unique<StaticQuadBatch>();
+        uint32_t quadCount = 0;
+        if (!readValue(file, batch->sortKey) || !readValue(file, batch->version) || !readValue(file, batch->bounds) || !readValue(file, quadCount)) {
+            return false;
+        }
+        if (quadCount > remainingBytes() / sizeof(QuadRenderCommand)) {
+            return false;
+        }
+        batch->quads.resize(quadCount);
+        if (!readBytes(file, batch->quads.data(), size_t(quadCount) * sizeof(QuadRenderCommand))) {
+            return false;
+        }
+        quadBatches.push_back(std::move(batch));
+        return true;
+    }
+
+    bool RenderTraceReader::readParticles() {
+        uint32_t count = 0;
+        if (!readValue(file, count) || count > remainingBytes() / (6 * sizeof(float))) {
+            return false;
+        }
+        auto pool = std::make_unique<particles::ParticlePool>(count);
+        pool->count = count;
+        for (float* values : {pool->posX.get(), pool->posY.get(), pool->r.get(), pool->g.get(), pool->b.get(), pool->a.get()}) {
+            if (!readBytes(file, values, size_t(count) * sizeof(float))) {
+                return false;
+            }
+        }
+        particlePools.push_back(std::move(pool));
+        return true;
+    }
+
+} // namespace parteeengine::rendering
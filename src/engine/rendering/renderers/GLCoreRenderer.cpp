@@ -0,0 +1,448 @@
+#include "engine/rendering/renderers/GLCoreRenderer.hpp"
+
+#include "engine/assets/Mesh.hpp"
+#include "engine/core/metrics/Metrics.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/rendering/textures/TextureRegistry.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <system_error>
+
+namespace parteeengine::rendering {
+
+    namespace {
+
+        constexpr size_t InitialStreamRegion = 1u << 20; // Bytes per frame before the ring first grows
+        constexpr uint64_t MeshRetentionFrames = 120;    // Frames an undrawn mesh, retained batch or texture keeps its GPU copy
+        constexpr float DepthRange = 1000.f;             // Meshes keep z within +-DepthRange
+
+        // Instanced attribute locations, matching the INSTANCED block of vertexShader.glsl
+        constexpr GLuint InstanceBasisLocation = 3;
+        constexpr GLuint InstanceOffsetLocation = 4;
+        constexpr GLuint InstanceColorLocation = 5;
+        constexpr GLuint InstanceUvLocation = 6;
+
+        const void* byteOffset(size_t offset) {
+            return reinterpret_cast<const void*>(offset);
+        }
+
+    } // namespace
+
+    GLCoreRenderer::GLCoreRenderer() {
+        std::error_code error;
+        std::filesystem::path temporary = std::filesystem::temp_directory_path(error);
+        if (!error) {
+            programCache.setDirectory(temporary / "parteeengine" / "programs");
+        }
+    }
+
+    GLCoreRenderer::~GLCoreRenderer() {
+        if (!program) {
+            return; // Never initialized, or the context failed
+        }
+        for (auto& [mesh, gpuMesh] : meshes) {
+            destroyGeometry(gpuMesh.geometry);
+        }
+        for (auto& [owner, instances] : retained) {
+            gl::DeleteBuffers(1, &instances.buffer);
+        }
+        for (auto& [id, gpuTexture] : textures) {
+            gl::DeleteTextures(1, &gpuTexture.texture);
+        }
+        destroyGeometry(quad);
+        stream.destroy();
+        gl::DeleteTextures(1, &whiteTexture);
+        if (framebuffer) {
+            gl::DeleteFramebuffers(1, &framebuffer);
+            gl::DeleteRenderbuffers(1, &colorBuffer);
+        }
+        gl::DeleteProgram(program);
+        context.destroy();
+    }
+
+    GLCoreRenderer& GLCoreRenderer::setFileSystem(const assets::VirtualFileSystem* fileSystem) {
+        this->fileSystem = fileSystem;
+        return *this;
+    }
+
+    GLCoreRenderer& GLCoreRenderer::setProgramCacheDirectory(std::filesystem::path directory) {
+        programCache.setDirectory(std::move(directory));
+        return *this;
+    }
+
+    bool GLCoreRenderer::initialize(IWindow& window) {
+        PARTEE_PROFILE_ZONE("GLCoreRenderer::initialize");
+        if (!context.create(window, 3, 3)) {
+            std::cerr << "GLCoreRenderer: " << context.getError() << "\n";
+            return false;
+        }
+        const char* missing = nullptr;
+        if (!gl::loadFunctions(&gl::GLContext::getProcAddress, &missing)) {
+            std::cerr << "GLCoreRenderer: driver is missing " << missing << "\n";
+            context.destroy();
+            return false;
+        }
+
+        std::string vertexSource, fragmentSource;
+        if (!readShader(VertexShaderPath, vertexSource) || !readShader(FragmentShaderPath, fragmentSource)) {
+            context.destroy();
+            return false;
+        }
+        programCache.initialize();
+        program = programCache.build(vertexSource, fragmentSource, "#define INSTANCED");
+        if (!program) {
+            std::cerr << "GLCoreRenderer: " << programCache.getError() << "\n";
+            context.destroy();
+            return false;
+        }
+        projectionLocation = gl::GetUniformLocation(program, "projection");
+        viewLocation = gl::GetUniformLocation(program, "view");
+        textureLocation = gl::GetUniformLocation(program, "texture1");
+
+        // Persistent mapping is GL 4.4; plain 3.3 drivers map each frame's range instead
+        bool persistent = gl::getVersion() >= 44 || gl::hasExtension("GL_ARB_buffer_storage");
+        if (!stream.create(InitialStreamRegion, persistent) && !stream.create(InitialStreamRegion, false)) {
+            std::cerr << "GLCoreRenderer: can't allocate the instance stream buffer\n";
+            stream.destroy();
+            gl::DeleteProgram(program);
+            program = 0;
+            context.destroy();
+            return false;
+        }
+
+        const uint32_t white = 0xFFFFFFFF;
+        gl::GenTextures(1, &whiteTexture);
+        gl::BindTexture(GL_TEXTURE_2D, whiteTexture);
+        gl::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+        gl::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        gl::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+        // Unit quad in the corner order QuadBatchBuilder uses, facing +z
+        const assets::MeshVertex corners[4] = {
+            {{-0.5f, -0.5f, 0.f}, {0.f, 0.f, 1.f}, {0.f, 0.f}},
+            {{ 0.5f, -0.5f, 0.f}, {0.f, 0.f, 1.f}, {1.f, 0.f}},
+            {{ 0.5f,  0.5f, 0.f}, {0.f, 0.f, 1.f}, {1.f, 1.f}},
+            {{-0.5f,  0.5f, 0.f}, {0.f, 0.f, 1.f}, {0.f, 1.f}},
+        };
+        const uint32_t quadIndices[6] = {0, 1, 2, 2, 3, 0};
+        quad = createGeometry(corners, quadIndices);
+
+        gl::Disable(GL_DEPTH_TEST);
+        gl::Disable(GL_CULL_FACE);
+        gl::Enable(GL_BLEND);
+        gl::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        WindowConfig config = window.getConfig();
+        resizeTarget(config.width, config.height);
+        frameCount = 0;
+        return true;
+    }
+
+    bool GLCoreRenderer::render(RenderFrame& frame, IWindow& window) {
+        RenderContext<GLCoreRenderer> renderContext = beginFrame(frame, window);
+        for (const RenderRun& run : frame.getRuns()) {
+            IRenderCommandBucket& bucket = *frame.getBuckets()[run.bucket];
+            auto it = handlers.find(bucket.getType());
+            if (it != handlers.end()) {
+                PARTEE_PROFILE_ZONE(bucket.getName());
+                it->second(bucket, run, renderContext);
+            }
+        }
+        endFrame(window);
+        return true;
+    }
+
+    RenderContext<GLCoreRenderer> GLCoreRenderer::beginFrame(RenderFrame& frame, IWindow& window) {
+        WindowConfig config = window.getConfig();
+        if (config.width != targetWidth || config.height != targetHeight) {
+            resizeTarget(config.width, config.height);
+        }
+
+        stream.beginFrame();
+        gl::BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        gl::Viewport(0, 0, targetWidth, targetHeight);
+        gl::ClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+        gl::Clear(GL_COLOR_BUFFER_BIT);
+
+        // The camera's viewport, flipped to GL's bottom-left origin. The projection maps
+        // its pixels with the origin top left and y down, like the fixed-function renderer.
+        RenderView view = frame.getView();
+        if (view.width <= 0 || view.height <= 0) {
+            view = RenderView::screen(targetWidth, targetHeight); // No view was set
+        }
+        gl::Viewport(view.x, targetHeight - view.y - view.height, view.width, view.height);
+        const float w = static_cast<float>(view.width > 0 ? view.width : 1);
+        const float h = static_cast<float>(view.height > 0 ? view.height : 1);
+        const float projection[16] = {
+            2.f / w, 0.f, 0.f, 0.f,
+            0.f, -2.f / h, 0.f, 0.f,
+            0.f, 0.f, -1.f / DepthRange, 0.f,
+            -1.f, 1.f, 0.f, 1.f
+        };
+        gl::UseProgram(program);
+        gl::UniformMatrix4fv(projectionLocation, 1, GL_FALSE, projection);
+        gl::UniformMatrix4fv(viewLocation, 1, GL_FALSE, view.view);
+        gl::Uniform1i(textureLocation, 0);
+        gl::ActiveTexture(GL_TEXTURE0);
+        gl::BindTexture(GL_TEXTURE_2D, whiteTexture);
+        boundTexture = 0;
+        drawCalls = 0;
+        return RenderContext<GLCoreRenderer>{ this, frameCount };
+    }
+
+    void GLCoreRenderer::endFrame(IWindow& window) {
+        stream.endFrame();
+        gl::BindVertexArray(0);
+
+        // Windows without a display take the frame in their back buffer
+        PixelSurface* surface = window.getNativeContext().surface;
+        if (framebuffer && surface && surface->pixels && surface->width == targetWidth && surface->height == targetHeight) {
+            PARTEE_PROFILE_ZONE("GLCoreRenderer::readTarget");
+            readTarget(reinterpret_cast<uint8_t*>(surface->pixels));
+        }
+        releaseUnusedResources();
+        metrics::Metrics::setGauge(metrics::names::DrawCalls, static_cast<double>(drawCalls));
+        ++frameCount;
+    }
+
+    GLCoreRenderer::InstanceRange GLCoreRenderer::allocateInstances(size_t count) {
+        gl::StreamRingBuffer::Allocation allocation = stream.allocate(count * sizeof(gl::InstanceData), alignof(gl::InstanceData));
+        if (!allocation.data) {
+            return {};
+        }
+        return InstanceRange{static_cast<gl::InstanceData*>(allocation.data), count, allocation.offset};
+    }
+
+    void GLCoreRenderer::drawQuads(const InstanceRange& range, size_t first, size_t count, uint32_t texture) {
+        drawInstanced(quad, 0, 6, range, first, count, texture);
+    }
+
+    void GLCoreRenderer::drawMesh(const assets::Mesh& mesh, const InstanceRange& range, size_t first, size_t count, uint32_t texture) {
+        if (mesh.indices.empty()) {
+            return;
+        }
+        // Keyed by id rather than address, so a mesh built where an evicted one was gets its own
+        // upload; the evicted one's is released once it goes undrawn for MeshRetentionFrames
+        auto [it, inserted] = meshes.try_emplace(mesh.id);
+        GpuMesh& gpuMesh = it->second;
+        if (inserted) {
+            gpuMesh.geometry = createGeometry(mesh.vertices, mesh.indices);
+        }
+        gpuMesh.lastUsedFrame = frameCount;
+
+        if (mesh.submeshes.empty()) {
+            drawInstanced(gpuMesh.geometry, 0, mesh.indices.size(), range, first, count, texture);
+            return;
+        }
+        for (const assets::Submesh& submesh : mesh.submeshes) {
+            drawInstanced(gpuMesh.geometry, submesh.indexOffset, submesh.indexCount, range, first, count, texture);
+        }
+    }
+
+    bool GLCoreRenderer::readPixels(std::vector<uint8_t>& rgba, int& width, int& height) {
+        if (!program || targetWidth <= 0 || targetHeight <= 0) {
+            return false;
+        }
+        width = targetWidth;
+        height = targetHeight;
+        rgba.resize(size_t(width) * size_t(height) * 4);
+        readTarget(rgba.data());
+        return true;
+    }
+
+    void GLCoreRenderer::readTarget(uint8_t* rgba) {
+        const size_t rowBytes = size_t(targetWidth) * 4;
+        gl::BindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        if (!framebuffer) {
+            gl::Finish(); // The window's back buffer may already be swapped out; read what is there
+        }
+        gl::PixelStorei(GL_PACK_ALIGNMENT, 1);
+        gl::ReadPixels(0, 0, targetWidth, targetHeight, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+
+        // GL rows run bottom to top
+        flipRow.resize(rowBytes);
+        for (int y = 0; y < targetHeight / 2; ++y) {
+            uint8_t* top = rgba + size_t(y) * rowBytes;
+            uint8_t* bottom = rgba + size_t(targetHeight - 1 - y) * rowBytes;
+            std::memcpy(flipRow.data(), top, rowBytes);
+            std::memcpy(top, bottom, rowBytes);
+            std::memcpy(bottom, flipRow.data(), rowBytes);
+        }
+    }
+
+    GLCoreRenderer::Geometry GLCoreRenderer::createGeometry(std::span<const assets::MeshVertex> vertices, std::span<const uint32_t> indices) {
+        Geometry geometry;
+        gl::GenVertexArrays(1, &geometry.vertexArray);
+        gl::BindVertexArray(geometry.vertexArray);
+
+        gl::GenBuffers(1, &geometry.vertexBuffer);
+        gl::BindBuffer(GL_ARRAY_BUFFER, geometry.vertexBuffer);
+        gl::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertices.size_bytes()), vertices.data(), GL_STATIC_DRAW);
+        gl::GenBuffers(1, &geometry.indexBuffer);
+        gl::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry.indexBuffer);
+        gl::BufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size_bytes()), indices.data(), GL_STATIC_DRAW);
+
+        const GLsizei stride = sizeof(assets::MeshVertex);
+        gl::EnableVertexAttribArray(0);
+        gl::VertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, byteOffset(offsetof(assets::MeshVertex, position)));
+        gl::EnableVertexAttribArray(1);
+        gl::VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, byteOffset(offsetof(assets::MeshVertex, uv)));
+        gl::EnableVertexAttribArray(2);
+        gl::VertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, stride, byteOffset(offsetof(assets::MeshVertex, normal)));
+
+        // Instance attributes are re-pointed at the stream buffer for every draw
+        for (GLuint location : {InstanceBasisLocation, InstanceOffsetLocation, InstanceColorLocation, InstanceUvLocation}) {
+            gl::EnableVertexAttribArray(location);
+            gl::VertexAttribDivisor(location, 1);
+        }
+        gl::BindVertexArray(0);
+        return geometry;
+    }
+
+    void GLCoreRenderer::destroyGeometry(Geometry& geometry) {
+        if (geometry.vertexArray) {
+            gl::DeleteVertexArrays(1, &geometry.vertexArray);
+            gl::DeleteBuffers(1, &geometry.vertexBuffer);
+            gl::DeleteBuffers(1, &geometry.indexBuffer);
+        }
+        geometry = {};
+    }
+
+    void GLCoreRenderer::drawInstanced(const Geometry& geometry, size_t firstIndex, size_t indexCount,
+        const InstanceRange& range, size_t first, size_t count, uint32_t texture) {
+        if (!range.data) {
+            return;
+        }
+        stream.commit();
+        // No base instance in 3.3, so the attribute pointers start at the first instance instead
+        drawInstances(geometry, firstIndex, indexCount, stream.getBuffer(), range.offset + first * sizeof(gl::InstanceData), count, texture);
+    }
+
+    void GLCoreRenderer::drawInstances(const Geometry& geometry, size_t firstIndex, size_t indexCount,
+        GLuint buffer, size_t offset, size_t count, uint32_t texture) {
+        if (count == 0 || indexCount == 0) {
+            return;
+        }
+        if (texture != boundTexture) {
+            bindTexture(texture);
+        }
+
+        const size_t base = offset;
+        const GLsizei stride = sizeof(gl::InstanceData);
+        gl::BindVertexArray(geometry.vertexArray);
+        gl::BindBuffer(GL_ARRAY_BUFFER, buffer);
+        gl::VertexAttribPointer(InstanceBasisLocation, 4, GL_FLOAT, GL_FALSE, stride, byteOffset(base + offsetof(gl::InstanceData, basis)));
+        gl::VertexAttribPointer(InstanceOffsetLocation, 2, GL_FLOAT, GL_FALSE, stride, byteOffset(base + offsetof(gl::InstanceData, offset)));
+        gl::VertexAttribPointer(InstanceColorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, byteOffset(base + offsetof(gl::InstanceData, color)));
+        gl::VertexAttribPointer(InstanceUvLocation, 4, GL_UNSIGNED_SHORT, GL_TRUE, stride, byteOffset(base + offsetof(gl::InstanceData, uv)));
+        gl::DrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT,
+            byteOffset(firstIndex * sizeof(uint32_t)), static_cast<GLsizei>(count));
+        ++drawCalls;
+    }
+
+    bool GLCoreRenderer::readShader(const char* path, std::string& source) {
+        assets::FileData file;
+        const assets::VirtualFileSystem& files = fileSystem ? *fileSystem : looseFiles;
+        if (!files.read(path, file)) {
+            std::cerr << "GLCoreRenderer: can't read " << path << "\n";
+            return false;
+        }
+        source.assign(file.contents());
+        return true;
+    }
+
+    void GLCoreRenderer::resizeTarget(int width, int height) {
+        targetWidth = width;
+        targetHeight = height;
+        if (!context.isOffscreen()) {
+            return; // The window's default framebuffer follows the window
+        }
+        if (!framebuffer) {
+            gl::GenFramebuffers(1, &framebuffer);
+            gl::GenRenderbuffers(1, &colorBuffer);
+        }
+        gl::BindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+        gl::RenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width > 0 ? width : 1, height > 0 ? height : 1);
+        gl::BindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        gl::FramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+        if (gl::CheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << "GLCoreRenderer: offscreen framebuffer " << width << "x" << height << " is incomplete\n";
+        }
+    }
+
+    void GLCoreRenderer::bindTexture(uint32_t texture) {
+        boundTexture = texture;
+        const uint64_t version = texture ? TextureRegistry::getVersion(texture) : 0;
+        if (version == 0) {
+            gl::BindTexture(GL_TEXTURE_2D, whiteTexture);
+            return;
+        }
+
+        GpuTexture& gpuTexture = textures[texture];
+        gpuTexture.lastUsedFrame = frameCount;
+        if (!gpuTexture.texture) {
+            gl::GenTextures(1, &gpuTexture.texture);
+        }
+        gl::BindTexture(GL_TEXTURE_2D, gpuTexture.texture);
+        if (gpuTexture.version == version) {
+            return;
+        }
+
+        PARTEE_PROFILE_ZONE("GLCoreRenderer::uploadTexture");
+        TextureRegistry::Entry entry = TextureRegistry::get(texture);
+        if (!entry.image || entry.image->width <= 0 || entry.image->height <= 0) {
+            gl::BindTexture(GL_TEXTURE_2D, whiteTexture);
+            return;
+        }
+        gl::PixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        gl::TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, entry.image->width, entry.image->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, entry.image->pixels.data());
+        // Also bounds the levels GenerateMipmap builds
+        gl::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, entry.image->maxMipLevel);
+        gl::GenerateMipmap(GL_TEXTURE_2D);
+        gl::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        gl::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        gl::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        gl::TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // Recorded after the upload, as the registry may have moved on since getVersion
+        gpuTexture.version = entry.version;
+    }
+
+    void GLCoreRenderer::uploadRetained(RetainedInstances& instances) {
+        if (!instances.buffer) {
+            gl::GenBuffers(1, &instances.buffer);
+        }
+        gl::BindBuffer(GL_ARRAY_BUFFER, instances.buffer);
+        gl::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(scratchInstances.size() * sizeof(gl::InstanceData)), scratchInstances.data(), GL_STATIC_DRAW);
+        instances.count = scratchInstances.size();
+    }
+
+    void GLCoreRenderer::releaseUnusedResources() {
+        for (auto it = meshes.begin(); it != meshes.end();) {
+            if (frameCount - it->second.lastUsedFrame > MeshRetentionFrames) {
+                destroyGeometry(it->second.geometry);
+                it = meshes.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (auto it = retained.begin(); it != retained.end();) {
+            if (frameCount - it->second.lastUsedFrame > MeshRetentionFrames) {
+                gl::DeleteBuffers(1, &it->second.buffer);
+                it = retained.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (auto it = textures.begin(); it != textures.end();) {
+            if (frameCount - it->second.lastUsedFrame > MeshRetentionFrames) {
+                gl::DeleteTextures(1, &it->second.texture);
+                it = textures.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,34 @@
+#include "engine/rendering/renderers/NullRenderer.hpp"
+
+#include "engine/core/profiling/Profiler.hpp"
+
+namespace parteeengine::rendering {
+
+    bool NullRenderer::initialize([[maybe_unused]]IWindow& window) {
+        frameCount = 0;
+        return true;
+    }
+
+    bool NullRenderer::render(RenderFrame& frame, IWindow& window) {
+        RenderContext<NullRenderer> context = beginFrame(frame, window);
+        for (const RenderRun& run : frame.getRuns()) {
+            IRenderCommandBucket& bucket = *frame.getBuckets()[run.bucket];
+            auto it = handlers.find(bucket.getType());
+            if (it != handlers.end()) {
+                PARTEE_PROFILE_ZONE(bucket.getName());
+                it->second(bucket, run, context);
+            }
+        }
+        endFrame(window);
+        return true;
+    }
+
+    RenderContext<NullRenderer> NullRenderer::beginFrame([[maybe_unused]]RenderFrame& frame, [[maybe_unused]]IWindow& window) {
+        return RenderContext<NullRenderer>{ frameCount };
+    }
+
+    void NullRenderer::endFrame([[maybe_unused]]IWindow& window) {
+        ++frameCount;
+    }
+
+} // namespace parteeengine::rendering
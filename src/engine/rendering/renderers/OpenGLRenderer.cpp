@@ -1,6 +1,8 @@
 #include "engine/rendering/renderers/OpenGLRenderer.hpp"
 
 #include "engine/rendering/renderers/OpenGLRenderContext.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/rendering/textures/TextureRegistry.hpp"
 
 namespace parteeengine::rendering {
     
@@ -24,20 +26,6 @@ namespace parteeengine::rendering {
         hglrc = wglCreateContext(hdc);
         wglMakeCurrent(hdc, hglrc);
 
-        // Setup viewport
-        RECT rect;
-        GetClientRect(static_cast<HWND>(window.getNativeContext().windowHandle), &rect);
-        glViewport(0, 0, rect.right, rect.bottom);
-
-        // Setup 2D orthographic projection for screen space rendering
-        glMatrixMode(GL_PROJECTION);
-        glLoadIdentity();
-
-        glOrtho(0, (float)rect.right, (float)rect.bottom, 0, -1, 1);
-        
-        glMatrixMode(GL_MODELVIEW);
-        glLoadIdentity();
-
         // Enable 2D rendering features
         glDisable(GL_DEPTH_TEST);
         glEnable(GL_BLEND);
@@ -47,19 +35,69 @@ namespace parteeengine::rendering {
         return true;
     };
 
-    bool OpenGLRenderer::render(RenderFrame& frame, [[maybe_unused]]IWindow& window) {
+    bool OpenGLRenderer::render(RenderFrame& frame, IWindow& window) {
+        RenderContext<OpenGLRenderer> context = beginFrame(frame, window);
+        for (const RenderRun& run : frame.getRuns()) {
+            IRenderCommandBucket& bucket = *frame.getBuckets()[run.bucket];
+            auto it = handlers.find(bucket.getType());
+            if (it != handlers.end()) {
+                PARTEE_PROFILE_ZONE(bucket.getName());
+                it->second(bucket, run, context);
+            }
+        }
+        endFrame(window);
+        return true;
+    };
+
+    RenderContext<OpenGLRenderer> OpenGLRenderer::beginFrame(RenderFrame& frame, IWindow& window) {
+        RECT rect;
+        GetClientRect(static_cast<HWND>(window.getNativeContext().windowHandle), &rect);
+        glViewport(0, 0, rect.right, rect.bottom);
         glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        RenderContext<OpenGLRenderer> context { hdc, hglrc };
+        // 2D orthographic projection over the camera's viewport, origin top left, y down
+        RenderView view = frame.getView();
+        if (view.width <= 0 || view.height <= 0) {
+            view = RenderView::screen(rect.right, rect.bottom); // No view was set
+        }
+        glViewport(view.x, rect.bottom - view.y - view.height, view.width, view.height);
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glOrtho(0, view.width, view.height, 0, -1, 1);
+
+        glMatrixMode(GL_MODELVIEW);
+        glLoadMatrixf(view.view);
+        return RenderContext<OpenGLRenderer>{ hdc, hglrc, this };
+    }
+
+    void OpenGLRenderer::endFrame([[maybe_unused]]IWindow& window) {
+    }
 
-        for (auto& [type, bucket] : frame.buckets) {
-            auto it = handlers.find(type);
-            if (it != handlers.end())
-                it->second(*bucket, context);
+    GLuint OpenGLRenderer::getTexture(uint32_t texture) {
+        const uint64_t version = texture ? TextureRegistry::getVersion(texture) : 0;
+        if (version == 0) {
+            return 0;
+        }
+        GpuTexture& gpuTexture = textures[texture];
+        if (gpuTexture.version == version) {
+            return gpuTexture.texture;
         }
 
-        return true;
-    };
+        TextureRegistry::Entry entry = TextureRegistry::get(texture);
+        if (!entry.image || entry.image->width <= 0 || entry.image->height <= 0) {
+            return 0;
+        }
+        if (!gpuTexture.texture) {
+            glGenTextures(1, &gpuTexture.texture);
+        }
+        // GL 1.1 has no mipmap generation, so atlases are sampled linearly from the base level
+        glBindTexture(GL_TEXTURE_2D, gpuTexture.texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, entry.image->width, entry.image->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, entry.image->pixels.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        gpuTexture.version = entry.version;
+        return gpuTexture.texture;
+    }
 
 } // namespace parteeengine::rendering
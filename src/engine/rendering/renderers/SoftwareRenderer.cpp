@@ -0,0 +1,319 @@
+#include "engine/rendering/renderers/SoftwareRenderer.hpp"
+
+#include "engine/assets/Mesh.hpp"
+#include "engine/core/profiling/Profiler.hpp"
+#include "engine/util/BatchMath.hpp"
+#include "engine/util/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+namespace parteeengine::rendering {
+
+    namespace {
+
+        float clamp01(float value) {
+            return std::clamp(value, 0.f, 1.f);
+        }
+
+        uint32_t packChannel(float value, int shift) {
+            return static_cast<uint32_t>(clamp01(value) * 255.f + 0.5f) << shift;
+        }
+
+        // Pixels exactly on an edge belong to the triangle only if it is a top or left edge,
+        // so two triangles sharing an edge never both draw it.
+        simd::Mask4 insideEdge(simd::Float4 w, bool topLeft) {
+            return topLeft ? w >= simd::set1(0.f) : w > simd::set1(0.f);
+        }
+
+    } // namespace
+
+    bool SoftwareRenderer::initialize(IWindow& window) {
+        WindowConfig config = window.getConfig();
+        framebuffer.resize(config.width, config.height);
+        frameCount = 0;
+        return true;
+    }
+
+    bool SoftwareRenderer::render(RenderFrame& frame, IWindow& window) {
+        RenderContext<SoftwareRenderer> context = beginFrame(frame, window);
+        for (const RenderRun& run : frame.getRuns()) {
+            IRenderCommandBucket& bucket = *frame.getBuckets()[run.bucket];
+            auto it = handlers.find(bucket.getType());
+            if (it != handlers.end()) {
+                PARTEE_PROFILE_ZONE(bucket.getName());
+                it->second(bucket, run, context);
+            }
+        }
+        endFrame(window);
+        return true;
+    }
+
+    RenderContext<SoftwareRenderer> SoftwareRenderer::beginFrame(RenderFrame& frame, IWindow& window) {
+        WindowConfig config = window.getConfig();
+        if (config.width != framebuffer.getWidth() || config.height != framebuffer.getHeight() || bins.empty()) {
+            framebuffer.resize(config.width, config.height);
+        }
+        const int width = framebuffer.getWidth();
+        const int height = framebuffer.getHeight();
+        tilesX = (width + TileSize - 1) / TileSize;
+        tilesY = (height + TileSize - 1) / TileSize;
+        bins.resize(size_t(tilesX) * size_t(tilesY));
+
+        RenderView renderView = frame.getView();
+        if (renderView.width <= 0 || renderView.height <= 0) {
+            renderView = RenderView::screen(width, height); // No view was set
+        }
+        const float* v = renderView.view;
+        view = Affine{{v[0], v[1], v[4], v[5], v[12] + static_cast<float>(renderView.x), v[13] + static_cast<float>(renderView.y)}};
+        scissorMinX = std::clamp(renderView.x, 0, width);
+        scissorMinY = std::clamp(renderView.y, 0, height);
+        scissorMaxX = std::clamp(renderView.x + renderView.width, 0, width);
+        scissorMaxY = std::clamp(renderView.y + renderView.height, 0, height);
+
+        triangles.clear();
+        return RenderContext<SoftwareRenderer>{ this, frameCount };
+    }
+
+    void SoftwareRenderer::endFrame(IWindow& window) {
+        const int width = framebuffer.getWidth();
+        const int height = framebuffer.getHeight();
+        {
+            PARTEE_PROFILE_ZONE("SoftwareRenderer::setup");
+            setupTriangles();
+            binTriangles();
+        }
+        {
+            PARTEE_PROFILE_ZONE("SoftwareRenderer::rasterize");
+            jobs::JobSystem::parallelFor(bins.size(), 1, [this](size_t begin, size_t end) {
+                for (size_t tile = begin; tile < end; ++tile) {
+                    rasterizeTile(tile);
+                }
+            });
+        }
+
+        // Windows without a display take the frame in their back buffer
+        if (PixelSurface* surface = window.getNativeContext().surface) {
+            if (surface->pixels && surface->width == width && surface->height == height) {
+                std::copy(framebuffer.data(), framebuffer.data() + size_t(width) * size_t(height), surface->pixels);
+            }
+        }
+
+        triangleCount = triangles.size();
+        ++frameCount;
+    }
+
+    SoftwareRenderer& SoftwareRenderer::setClearColor(Color color) {
+        clearColor = color;
+        return *this;
+    }
+
+    void SoftwareRenderer::drawMesh(const assets::Mesh& mesh, const Transform2d& transform, const Color& color) {
+        const size_t count = mesh.indices.size() / 3;
+        Triangle* out = allocateTriangles(count).data();
+        const Affine pixels = toPixels(transform);
+        const float* m = pixels.m;
+
+        // Each vertex is transformed once, four at a time, however many triangles share it
+        const size_t vertexCount = mesh.vertices.size();
+        vertexX.resize(vertexCount);
+        vertexY.resize(vertexCount);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            vertexX[v] = mesh.vertices[v].position[0];
+            vertexY[v] = mesh.vertices[v].position[1];
+        }
+        const Mat3 toPixel({m[0], m[1], 0.f}, {m[2], m[3], 0.f}, {m[4], m[5], 1.f});
+        simd::transformPoints(toPixel, vertexX.data(), vertexY.data(), vertexX.data(), vertexY.data(), vertexCount);
+
+        for (size_t i = 0; i < count; ++i) {
+            Triangle& triangle = out[i];
+            for (int corner = 0; corner < 3; ++corner) {
+                const uint32_t index = mesh.indices[i * 3 + corner];
+                triangle.x[corner] = vertexX[index];
+                triangle.y[corner] = vertexY[index];
+            }
+            triangle.color = color;
+        }
+    }
+
+    std::span<SoftwareRenderer::Triangle> SoftwareRenderer::allocateTriangles(size_t count) {
+        const size_t first = triangles.size();
+        triangles.resize(first + count);
+        return std::span<Triangle>(triangles).subspan(first, count);
+    }
+
+    SoftwareRenderer::Affine SoftwareRenderer::toPixels(const Transform2d& transform) const {
+        const float radians = transform.rotation * std::numbers::pi_v<float> / 180.f;
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        // Model axes, scaled and rotated like the GL renderers' instance basis
+        const float xx = transform.scale.x * c, xy = transform.scale.x * s;
+        const float yx = -transform.scale.y * s, yy = transform.scale.y * c;
+        const float tx = transform.position.x, ty = transform.position.y;
+        const float* v = view.m;
+        return Affine{{
+            v[0] * xx + v[2] * xy, v[1] * xx + v[3] * xy,
+            v[0] * yx + v[2] * yy, v[1] * yx + v[3] * yy,
+            v[0] * tx + v[2] * ty + v[4], v[1] * tx + v[3] * ty + v[5]
+        }};
+    }
+
+    void SoftwareRenderer::writeQuad(const Transform2d& transform, const Color& color, Triangle* out) const {
+        const Affine pixels = toPixels(transform);
+        const float* m = pixels.m;
+        const float cornerX[4] = {-0.5f, 0.5f, 0.5f, -0.5f};
+        const float cornerY[4] = {-0.5f, -0.5f, 0.5f, 0.5f};
+        float x[4], y[4];
+        for (int i = 0; i < 4; ++i) {
+            x[i] = m[0] * cornerX[i] + m[2] * cornerY[i] + m[4];
+            y[i] = m[1] * cornerX[i] + m[3] * cornerY[i] + m[5];
+        }
+        out[0] = Triangle{{x[0], x[1], x[2]}, {y[0], y[1], y[2]}, color};
+        out[1] = Triangle{{x[0], x[2], x[3]}, {y[0], y[2], y[3]}, color};
+    }
+
+    void SoftwareRenderer::setupTriangles() {
+        setups.resize(triangles.size());
+        jobs::JobSystem::parallelFor(triangles.size(), 4096, [this](size_t begin, size_t end) {
+            // Keeps the float to int conversion of far-off corners in range
+            const float limitMinX = static_cast<float>(scissorMinX) - 1.f, limitMaxX = static_cast<float>(scissorMaxX) + 1.f;
+            const float limitMinY = static_cast<float>(scissorMinY) - 1.f, limitMaxY = static_cast<float>(scissorMaxY) + 1.f;
+            for (size_t i = begin; i < end; ++i) {
+                const Triangle& triangle = triangles[i];
+                Setup& setup = setups[i];
+                float x[3] = {triangle.x[0], triangle.x[1], triangle.x[2]};
+                float y[3] = {triangle.y[0], triangle.y[1], triangle.y[2]};
+
+                float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+                if (!std::isfinite(area) || area == 0.f) {
+                    setup.minX = setup.maxX = 0;
+                    setup.minY = setup.maxY = 0;
+                    continue;
+                }
+                if (area < 0.f) {
+                    std::swap(x[1], x[2]);
+                    std::swap(y[1], y[2]);
+                }
+
+                // Edge i runs between the two corners other than i
+                setup.topLeft = 0;
+                for (int edge = 0; edge < 3; ++edge) {
+                    const int a = (edge + 1) % 3;
+                    const int b = (edge + 2) % 3;
+                    const float dx = x[b] - x[a];
+                    const float dy = y[b] - y[a];
+                    setup.edgeA[edge] = -dy;
+                    setup.edgeB[edge] = dx;
+                    setup.edgeC[edge] = dy * x[a] - dx * y[a];
+                    if (dy < 0.f || (dy == 0.f && dx > 0.f)) {
+                        setup.topLeft |= 1u << edge;
+                    }
+                }
+
+                // Pixels whose centers can be inside, clipped to the viewport
+                const float minX = std::clamp(std::min({x[0], x[1], x[2]}), limitMinX, limitMaxX);
+                const float maxX = std::clamp(std::max({x[0], x[1], x[2]}), limitMinX, limitMaxX);
+                const float minY = std::clamp(std::min({y[0], y[1], y[2]}), limitMinY, limitMaxY);
+                const float maxY = std::clamp(std::max({y[0], y[1], y[2]}), limitMinY, limitMaxY);
+                setup.minX = std::max(static_cast<int>(std::ceil(minX - 0.5f)), scissorMinX);
+                setup.maxX = std::min(static_cast<int>(std::floor(maxX - 0.5f)) + 1, scissorMaxX);
+                setup.minY = std::max(static_cast<int>(std::ceil(minY - 0.5f)), scissorMinY);
+                setup.maxY = std::min(static_cast<int>(std::floor(maxY - 0.5f)) + 1, scissorMaxY);
+            }
+        });
+    }
+
+    void SoftwareRenderer::binTriangles() {
+        for (auto& bin : bins) {
+            bin.clear();
+        }
+        for (size_t i = 0; i < setups.size(); ++i) {
+            const Setup& setup = setups[i];
+            if (setup.minX >= setup.maxX || setup.minY >= setup.maxY) {
+                continue;
+            }
+            const int lastTileX = (setup.maxX - 1) / TileSize;
+            const int lastTileY = (setup.maxY - 1) / TileSize;
+            for (int tileY = setup.minY / TileSize; tileY <= lastTileY; ++tileY) {
+                for (int tileX = setup.minX / TileSize; tileX <= lastTileX; ++tileX) {
+                    bins[size_t(tileY) * size_t(tilesX) + size_t(tileX)].push_back(static_cast<uint32_t>(i));
+                }
+            }
+        }
+    }
+
+    void SoftwareRenderer::rasterizeTile(size_t tile) {
+        using namespace simd;
+
+        const int tileX = static_cast<int>(tile % size_t(tilesX)) * TileSize;
+        const int tileY = static_cast<int>(tile / size_t(tilesX)) * TileSize;
+        const int tileWidth = std::min(TileSize, framebuffer.getWidth() - tileX);
+        const int tileHeight = std::min(TileSize, framebuffer.getHeight() - tileY);
+
+        // Blending happens in float, one plane per channel; the destination alpha stays opaque
+        alignas(16) float red[TileSize * TileSize];
+        alignas(16) float green[TileSize * TileSize];
+        alignas(16) float blue[TileSize * TileSize];
+        std::fill(std::begin(red), std::end(red), clearColor.r);
+        std::fill(std::begin(green), std::end(green), clearColor.g);
+        std::fill(std::begin(blue), std::end(blue), clearColor.b);
+
+        const Float4 laneOffset = set(0.5f, 1.5f, 2.5f, 3.5f); // Pixel centers
+        for (uint32_t index : bins[tile]) {
+            const Setup& setup = setups[index];
+            const int x0 = std::max(setup.minX, tileX);
+            const int x1 = std::min(setup.maxX, tileX + tileWidth);
+            const int y0 = std::max(setup.minY, tileY);
+            const int y1 = std::min(setup.maxY, tileY + tileHeight);
+            if (x0 >= x1 || y0 >= y1) {
+                continue;
+            }
+            const int startX = tileX + ((x0 - tileX) & ~(Width - 1)); // Whole SIMD groups within the tile row
+
+            const Color& color = triangles[index].color;
+            const Float4 alpha = set1(clamp01(color.a));
+            const Float4 sourceRed = set1(color.r), sourceGreen = set1(color.g), sourceBlue = set1(color.b);
+            const Float4 a0 = set1(setup.edgeA[0]), a1 = set1(setup.edgeA[1]), a2 = set1(setup.edgeA[2]);
+            const bool topLeft0 = setup.topLeft & 1, topLeft1 = setup.topLeft & 2, topLeft2 = setup.topLeft & 4;
+            const Float4 columnMin = set1(static_cast<float>(x0));
+            const Float4 columnMax = set1(static_cast<float>(x1));
+
+            for (int y = y0; y < y1; ++y) {
+                const float centerY = static_cast<float>(y) + 0.5f;
+                const Float4 row0 = set1(setup.edgeB[0] * centerY + setup.edgeC[0]);
+                const Float4 row1 = set1(setup.edgeB[1] * centerY + setup.edgeC[1]);
+                const Float4 row2 = set1(setup.edgeB[2] * centerY + setup.edgeC[2]);
+                const size_t rowOffset = size_t(y - tileY) * TileSize;
+
+                for (int x = startX; x < x1; x += Width) {
+                    const Float4 centerX = set1(static_cast<float>(x)) + laneOffset;
+                    const Mask4 inside = (centerX > columnMin) & (centerX < columnMax)
+                        & insideEdge(a0 * centerX + row0, topLeft0)
+                        & insideEdge(a1 * centerX + row1, topLeft1)
+                        & insideEdge(a2 * centerX + row2, topLeft2);
+                    if (bitmask(inside) == 0) {
+                        continue;
+                    }
+                    const size_t offset = rowOffset + size_t(x - tileX);
+                    const Float4 r = load(red + offset), g = load(green + offset), b = load(blue + offset);
+                    store(red + offset, select(inside, r, r + (sourceRed - r) * alpha));
+                    store(green + offset, select(inside, g, g + (sourceGreen - g) * alpha));
+                    store(blue + offset, select(inside, b, b + (sourceBlue - b) * alpha));
+                }
+            }
+        }
+
+        uint32_t* pixels = framebuffer.data();
+        for (int y = 0; y < tileHeight; ++y) {
+            uint32_t* row = pixels + size_t(tileY + y) * size_t(framebuffer.getWidth()) + size_t(tileX);
+            const size_t rowOffset = size_t(y) * TileSize;
+            for (int x = 0; x < tileWidth; ++x) {
+                const size_t i = rowOffset + size_t(x);
+                row[x] = packChannel(red[i], 0) | packChannel(green[i], 8) | packChannel(blue[i], 16) | 0xFF000000u;
+            }
+        }
+    }
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,183 @@
+#include "engine/rendering/renderers/glcore/GLContext.hpp"
+
+#include "engine/rendering/windows/IWindow.hpp"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <cstdint>
+#else
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+namespace parteeengine::rendering::gl {
+
+#if defined(_WIN32)
+
+    namespace {
+
+        // From WGL_ARB_create_context / WGL_ARB_create_context_profile
+        constexpr int WGL_CONTEXT_MAJOR_VERSION_ARB = 0x2091;
+        constexpr int WGL_CONTEXT_MINOR_VERSION_ARB = 0x2092;
+        constexpr int WGL_CONTEXT_PROFILE_MASK_ARB = 0x9126;
+        constexpr int WGL_CONTEXT_CORE_PROFILE_BIT_ARB = 0x1;
+        using CreateContextAttribsFunction = HGLRC (WINAPI*)(HDC, HGLRC, const int*);
+
+    } // namespace
+
+    GLContext::~GLContext() {
+        destroy();
+    }
+
+    bool GLContext::create(IWindow& window, int major, int minor) {
+        HDC hdc = static_cast<HDC>(window.getNativeContext().deviceContext);
+        if (!hdc) {
+            error = "Window has no device context";
+            return false;
+        }
+
+        PIXELFORMATDESCRIPTOR pfd = {
+            sizeof(PIXELFORMATDESCRIPTOR),
+            1,
+            PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER,
+            PFD_TYPE_RGBA,
+            32, // Color depth
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            24, // Depth buffer
+            8,  // Stencil buffer
+            0, PFD_MAIN_PLANE, 0, 0, 0, 0
+        };
+        SetPixelFormat(hdc, ChoosePixelFormat(hdc, &pfd), &pfd);
+
+        // wglCreateContextAttribsARB can only be looked up with some context current
+        HGLRC legacy = wglCreateContext(hdc);
+        if (!legacy || !wglMakeCurrent(hdc, legacy)) {
+            error = "wglCreateContext failed";
+            return false;
+        }
+        auto createContextAttribs = reinterpret_cast<CreateContextAttribsFunction>(wglGetProcAddress("wglCreateContextAttribsARB"));
+        HGLRC core = nullptr;
+        if (createContextAttribs) {
+            const int attributes[] = {
+                WGL_CONTEXT_MAJOR_VERSION_ARB, major,
+                WGL_CONTEXT_MINOR_VERSION_ARB, minor,
+                WGL_CONTEXT_PROFILE_MASK_ARB, WGL_CONTEXT_CORE_PROFILE_BIT_ARB,
+                0
+            };
+            core = createContextAttribs(hdc, nullptr, attributes);
+        }
+        wglMakeCurrent(nullptr, nullptr);
+        wglDeleteContext(legacy);
+        if (!core) {
+            error = "Driver has no OpenGL " + std::to_string(major) + "." + std::to_string(minor) + " core profile";
+            return false;
+        }
+
+        wglMakeCurrent(hdc, core);
+        display = hdc;
+        context = core;
+        return true;
+    }
+
+    void GLContext::destroy() {
+        if (context) {
+            wglMakeCurrent(nullptr, nullptr);
+            wglDeleteContext(static_cast<HGLRC>(context));
+            context = nullptr;
+        }
+        display = nullptr;
+    }
+
+    void* GLContext::getProcAddress(const char* name) {
+        PROC proc = wglGetProcAddress(name);
+        // wglGetProcAddress only knows extensions and post-1.1 functions, and some drivers return small sentinels
+        intptr_t value = reinterpret_cast<intptr_t>(proc);
+        if (value >= -1 && value <= 3) {
+            static HMODULE library = LoadLibraryA("opengl32.dll");
+            proc = GetProcAddress(library, name);
+        }
+        return reinterpret_cast<void*>(proc);
+    }
+
+    bool GLContext::isOffscreen() const {
+        return false;
+    }
+
+#else
+
+    GLContext::~GLContext() {
+        destroy();
+    }
+
+    bool GLContext::create([[maybe_unused]]IWindow& window, int major, int minor) {
+        // The surfaceless platform needs neither a display server nor a GPU
+        EGLDisplay eglDisplay = EGL_NO_DISPLAY;
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay) {
+            eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+        if (eglDisplay == EGL_NO_DISPLAY) {
+            eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        }
+        if (eglDisplay == EGL_NO_DISPLAY || !eglInitialize(eglDisplay, nullptr, nullptr)) {
+            error = "No EGL display";
+            return false;
+        }
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            error = "EGL has no desktop OpenGL";
+            eglTerminate(eglDisplay);
+            return false;
+        }
+
+        const EGLint attributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, major,
+            EGL_CONTEXT_MINOR_VERSION, minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        // EGL_KHR_no_config_context: no surface is ever created, so no config is needed
+        EGLContext eglContext = eglCreateContext(eglDisplay, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+        if (eglContext == EGL_NO_CONTEXT) {
+            error = "Driver has no OpenGL " + std::to_string(major) + "." + std::to_string(minor) + " core profile";
+            eglTerminate(eglDisplay);
+            return false;
+        }
+        if (!eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, eglContext)) {
+            error = "Driver can't make a surfaceless context current";
+            eglDestroyContext(eglDisplay, eglContext);
+            eglTerminate(eglDisplay);
+            return false;
+        }
+
+        display = eglDisplay;
+        context = eglContext;
+        return true;
+    }
+
+    void GLContext::destroy() {
+        if (context) {
+            eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(display, context);
+            context = nullptr;
+        }
+        if (display) {
+            eglTerminate(display);
+            display = nullptr;
+        }
+    }
+
+    void* GLContext::getProcAddress(const char* name) {
+        // EGL 1.5 resolves core functions as well as extensions
+        return reinterpret_cast<void*>(eglGetProcAddress(name));
+    }
+
+    bool GLContext::isOffscreen() const {
+        return true;
+    }
+
+#endif
+
+} // namespace parteeengine::rendering::gl
@@ -0,0 +1,46 @@
+#include "engine/rendering/renderers/glcore/GLFunctions.hpp"
+
+#include <cstring>
+
+namespace parteeengine::rendering::gl {
+
+    bool loadFunctions(ProcAddressLoader loader, const char** missing) {
+#define PARTEE_GL_LOAD_REQUIRED(ret, name, params) \
+        name = reinterpret_cast<name##Function>(loader("gl" #name)); \
+        if (!name) { \
+            if (missing) { \
+                *missing = "gl" #name; \
+            } \
+            return false; \
+        }
+#define PARTEE_GL_LOAD_OPTIONAL(ret, name, params) \
+        name = reinterpret_cast<name##Function>(loader("gl" #name));
+
+        PARTEE_GL_REQUIRED_FUNCTIONS(PARTEE_GL_LOAD_REQUIRED)
+        PARTEE_GL_OPTIONAL_FUNCTIONS(PARTEE_GL_LOAD_OPTIONAL)
+
+#undef PARTEE_GL_LOAD_REQUIRED
+#undef PARTEE_GL_LOAD_OPTIONAL
+        return true;
+    }
+
+    bool hasExtension(const char* name) {
+        GLint count = 0;
+        GetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; ++i) {
+            const char* extension = reinterpret_cast<const char*>(GetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+            if (extension && std::strcmp(extension, name) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int getVersion() {
+        GLint major = 0, minor = 0;
+        GetIntegerv(GL_MAJOR_VERSION, &major);
+        GetIntegerv(GL_MINOR_VERSION, &minor);
+        return major * 10 + minor;
+    }
+
+} // namespace parteeengine::rendering::gl
@@ -0,0 +1,222 @@
+#include "engine/rendering/renderers/glcore/ProgramCache.hpp"
+
+#include "engine/core/profiling/Profiler.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <system_error>
+#include <vector>
+
+namespace parteeengine::rendering::gl {
+
+    namespace {
+
+        // FNV-1a over each part, with the length mixed in so part boundaries count
+        uint64_t hashParts(std::initializer_list<std::string_view> parts) {
+            uint64_t hash = 14695981039346656037ull;
+            auto mix = [&hash](const void* data, size_t size) {
+                const auto* bytes = static_cast<const unsigned char*>(data);
+                for (size_t i = 0; i < size; ++i) {
+                    hash = (hash ^ bytes[i]) * 1099511628211ull;
+                }
+            };
+            for (std::string_view part : parts) {
+                uint64_t length = part.size();
+                mix(&length, sizeof(length));
+                mix(part.data(), part.size());
+            }
+            return hash;
+        }
+
+        std::string toString(const GLubyte* value) {
+            return value ? reinterpret_cast<const char*>(value) : "";
+        }
+
+        GLuint compileShader(GLenum type, std::string_view source, std::string_view defines, std::string& error) {
+            // defines go between the #version line, which must come first, and the rest
+            std::string_view version, body = source;
+            if (source.starts_with("#version")) {
+                size_t lineEnd = source.find('\n');
+                lineEnd = lineEnd == std::string_view::npos ? source.size() : lineEnd + 1;
+                version = source.substr(0, lineEnd);
+                body = source.substr(lineEnd);
+            }
+            std::string full(version);
+            if (!defines.empty()) {
+                // #line keeps compiler messages pointing at the lines of the file
+                full += std::string(defines) + "\n#line " + (version.empty() ? "1" : "2") + "\n";
+            }
+            full += body;
+
+            const GLchar* text = full.c_str();
+            GLuint shader = CreateShader(type);
+            ShaderSource(shader, 1, &text, nullptr);
+            CompileShader(shader);
+
+            GLint compiled = GL_FALSE;
+            GetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+            if (!compiled) {
+                GLint logLength = 0;
+                GetShaderiv(shader, GL_INFO_LOG_LENGTH, &logLength);
+                std::string log(static_cast<size_t>(logLength > 0 ? logLength : 1), '\0');
+                GetShaderInfoLog(shader, logLength, nullptr, log.data());
+                error = (type == GL_VERTEX_SHADER ? "Vertex shader: " : "Fragment shader: ") + std::string(log.c_str());
+                DeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+
+        bool isLinked(GLuint program) {
+            GLint linked = GL_FALSE;
+            GetProgramiv(program, GL_LINK_STATUS, &linked);
+            return linked == GL_TRUE;
+        }
+
+    } // namespace
+
+    void ProgramCache::initialize() {
+        driver = toString(GetString(GL_VENDOR)) + "|" + toString(GetString(GL_RENDERER)) + "|" + toString(GetString(GL_VERSION));
+        GLint formats = 0;
+        if (ProgramBinary && GetProgramBinary && ProgramParameteri) {
+            GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        supported = formats > 0;
+    }
+
+    ProgramCache& ProgramCache::setDirectory(std::filesystem::path directory) {
+        this->directory = std::move(directory);
+        return *this;
+    }
+
+    GLuint ProgramCache::build(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines) {
+        PARTEE_PROFILE_ZONE("ProgramCache::build");
+        error.clear();
+        bool useDisk = supported && !directory.empty();
+        uint64_t key = hashParts({driver, defines, vertexSource, fragmentSource});
+        if (useDisk) {
+            if (GLuint program = loadBinary(key)) {
+                ++hits;
+                return program;
+            }
+        }
+
+        ++misses;
+        GLuint program = compileAndLink(vertexSource, fragmentSource, defines);
+        if (program && useDisk) {
+            storeBinary(key, program);
+        }
+        return program;
+    }
+
+    GLuint ProgramCache::loadBinary(uint64_t key) {
+        std::ifstream file(pathFor(key), std::ios::binary | std::ios::ate);
+        if (!file) {
+            return 0;
+        }
+        const std::streamoff fileSize = file.tellg();
+        file.seekg(0, std::ios::beg);
+        FileHeader header{};
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+            || std::memcmp(header.magic, Magic, sizeof(Magic)) != 0
+            || header.version != Version || header.key != key) {
+            return 0;
+        }
+        // A corrupt or truncated file must not make us allocate more than it holds
+        if (fileSize < 0 || uint64_t(header.length) > uint64_t(fileSize) - sizeof(header)) {
+            return 0;
+        }
+        std::vector<char> binary(header.length);
+        if (!file.read(binary.data(), static_cast<std::streamsize>(binary.size()))) {
+            return 0;
+        }
+
+        GLuint program = CreateProgram();
+        ProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+        if (!isLinked(program)) {
+            // Usually a driver update the version string didn't reveal; rebuild and overwrite
+            DeleteProgram(program);
+            return 0;
+        }
+        return program;
+    }
+
+    void ProgramCache::storeBinary(uint64_t key, GLuint program) {
+        GLint length = 0;
+        GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) {
+            return;
+        }
+        std::vector<char> binary(static_cast<size_t>(length));
+        GLenum format = 0;
+        GetProgramBinary(program, length, &length, &format, binary.data());
+
+        std::error_code ignored;
+        std::filesystem::create_directories(directory, ignored);
+        std::filesystem::path path = pathFor(key);
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            FileHeader header{};
+            std::memcpy(header.magic, Magic, sizeof(Magic));
+            header.version = Version;
+            header.key = key;
+            header.format = format;
+            header.length = static_cast<uint32_t>(length);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(binary.data(), length);
+            if (!file) {
+                file.close();
+                std::filesystem::remove(temporary, ignored);
+                return;
+            }
+        }
+        // Another process starting at the same time sees either no file or a whole one
+        std::filesystem::rename(temporary, path, ignored);
+    }
+
+    GLuint ProgramCache::compileAndLink(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines) {
+        GLuint vertex = compileShader(GL_VERTEX_SHADER, vertexSource, defines, error);
+        if (!vertex) {
+            return 0;
+        }
+        GLuint fragment = compileShader(GL_FRAGMENT_SHADER, fragmentSource, defines, error);
+        if (!fragment) {
+            DeleteShader(vertex);
+            return 0;
+        }
+
+        GLuint program = CreateProgram();
+        if (supported) {
+            ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        AttachShader(program, vertex);
+        AttachShader(program, fragment);
+        LinkProgram(program);
+        DetachShader(program, vertex);
+        DetachShader(program, fragment);
+        DeleteShader(vertex);
+        DeleteShader(fragment);
+
+        if (!isLinked(program)) {
+            GLint logLength = 0;
+            GetProgramiv(program, GL_INFO_LOG_LENGTH, &logLength);
+            std::string log(static_cast<size_t>(logLength > 0 ? logLength : 1), '\0');
+            GetProgramInfoLog(program, logLength, nullptr, log.data());
+            error = "Link: " + std::string(log.c_str());
+            DeleteProgram(program);
+            return 0;
+        }
+        return program;
+    }
+
+    std::filesystem::path ProgramCache::pathFor(uint64_t key) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+        return directory / name;
+    }
+
+} // namespace parteeengine::rendering::gl
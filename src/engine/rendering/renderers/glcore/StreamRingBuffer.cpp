@@ -0,0 +1,147 @@
+#include "engine/rendering/renderers/glcore/StreamRingBuffer.hpp"
+
+#include "engine/core/profiling/Profiler.hpp"
+
+#include <algorithm>
+
+namespace parteeengine::rendering::gl {
+
+    namespace {
+
+        constexpr GLbitfield PersistentFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        constexpr GLuint64 WaitTimeout = 1'000'000'000; // 1 s per ClientWaitSync call, in ns
+
+    } // namespace
+
+    StreamRingBuffer::~StreamRingBuffer() {
+        destroy();
+    }
+
+    bool StreamRingBuffer::create(size_t regionSize, bool persistent) {
+        destroy();
+        this->regionSize = std::max<size_t>(regionSize, 4096);
+        this->persistent = persistent && BufferStorage;
+        region = 0;
+        head = 0;
+        return allocateStorage();
+    }
+
+    void StreamRingBuffer::destroy() {
+        if (buffer) {
+            releaseStorage();
+        }
+    }
+
+    void StreamRingBuffer::beginFrame() {
+        region = (region + 1) % FramesInFlight;
+        head = 0;
+        waitForRegion(region);
+    }
+
+    void StreamRingBuffer::endFrame() {
+        commit();
+        fences[region] = FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    StreamRingBuffer::Allocation StreamRingBuffer::allocate(size_t bytes, size_t alignment) {
+        commit();
+        if (bytes == 0 || !buffer) {
+            return {};
+        }
+        size_t start = (head + alignment - 1) / alignment * alignment;
+        if (start + bytes > regionSize) {
+            grow(bytes);
+            if (!buffer) {
+                return {};
+            }
+            start = 0;
+        }
+        head = start + bytes;
+
+        Allocation allocation;
+        allocation.offset = region * regionSize + start;
+        if (persistent) {
+            allocation.data = mapping + allocation.offset;
+        } else {
+            // Unsynchronized is safe: the fence on this region already guaranteed the GPU is done with it
+            BindBuffer(GL_ARRAY_BUFFER, buffer);
+            allocation.data = MapBufferRange(GL_ARRAY_BUFFER, static_cast<GLintptr>(allocation.offset), static_cast<GLsizeiptr>(bytes),
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+            mapped = allocation.data != nullptr;
+        }
+        return allocation;
+    }
+
+    void StreamRingBuffer::commit() {
+        if (mapped) {
+            BindBuffer(GL_ARRAY_BUFFER, buffer);
+            UnmapBuffer(GL_ARRAY_BUFFER);
+            mapped = false;
+        }
+    }
+
+    bool StreamRingBuffer::allocateStorage() {
+        GenBuffers(1, &buffer);
+        BindBuffer(GL_ARRAY_BUFFER, buffer);
+        GLsizeiptr total = static_cast<GLsizeiptr>(regionSize * FramesInFlight);
+        if (persistent) {
+            BufferStorage(GL_ARRAY_BUFFER, total, nullptr, PersistentFlags);
+            mapping = static_cast<unsigned char*>(MapBufferRange(GL_ARRAY_BUFFER, 0, total, PersistentFlags));
+            if (!mapping) {
+                DeleteBuffers(1, &buffer);
+                buffer = 0;
+                return false;
+            }
+        } else {
+            BufferData(GL_ARRAY_BUFFER, total, nullptr, GL_STREAM_DRAW);
+        }
+        return true;
+    }
+
+    void StreamRingBuffer::releaseStorage() {
+        commit();
+        if (mapping) {
+            BindBuffer(GL_ARRAY_BUFFER, buffer);
+            UnmapBuffer(GL_ARRAY_BUFFER);
+            mapping = nullptr;
+        }
+        DeleteBuffers(1, &buffer);
+        buffer = 0;
+        for (GLsync& fence : fences) {
+            if (fence) {
+                DeleteSync(fence);
+                fence = nullptr;
+            }
+        }
+    }
+
+    void StreamRingBuffer::waitForRegion(size_t index) {
+        GLsync& fence = fences[index];
+        if (!fence) {
+            return;
+        }
+        PARTEE_PROFILE_ZONE("StreamRingBuffer::wait");
+        GLenum result;
+        do {
+            result = ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WaitTimeout);
+        } while (result == GL_TIMEOUT_EXPIRED);
+        DeleteSync(fence);
+        fence = nullptr;
+    }
+
+    void StreamRingBuffer::grow(size_t required) {
+        PARTEE_PROFILE_ZONE("StreamRingBuffer::grow");
+        // Draws already issued from the old buffer keep it alive until they finish
+        for (size_t i = 0; i < FramesInFlight; ++i) {
+            waitForRegion(i);
+        }
+        releaseStorage();
+        while (regionSize < required) {
+            regionSize *= 2;
+        }
+        regionSize *= 2; // Headroom so a frame that grew once doesn't grow again right away
+        head = 0;
+        allocateStorage();
+    }
+
+} // namespace parteeengine::rendering::gl
@@ -0,0 +1,148 @@
+#include "engine/rendering/renderers/software/Framebuffer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <string>
+
+namespace parteeengine::rendering::software {
+
+    namespace {
+
+        const std::array<uint32_t, 256>& crcTable() {
+            static const std::array<uint32_t, 256> table = [] {
+                std::array<uint32_t, 256> result{};
+                for (uint32_t n = 0; n < 256; ++n) {
+                    uint32_t c = n;
+                    for (int k = 0; k < 8; ++k) {
+                        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                    }
+                    result[n] = c;
+                }
+                return result;
+            }();
+            return table;
+        }
+
+        uint32_t updateCrc(uint32_t crc, const uint8_t* data, size_t size) {
+            const auto& table = crcTable();
+            for (size_t i = 0; i < size; ++i) {
+                crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+            }
+            return crc;
+        }
+
+        void appendBigEndian(std::vector<uint8_t>& out, uint32_t value) {
+            out.push_back(static_cast<uint8_t>(value >> 24));
+            out.push_back(static_cast<uint8_t>(value >> 16));
+            out.push_back(static_cast<uint8_t>(value >> 8));
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        // Length, type, data and CRC over type and data.
+        void appendChunk(std::vector<uint8_t>& out, const char type[4], const std::vector<uint8_t>& data) {
+            appendBigEndian(out, static_cast<uint32_t>(data.size()));
+            const size_t typeOffset = out.size();
+            out.insert(out.end(), type, type + 4);
+            out.insert(out.end(), data.begin(), data.end());
+            uint32_t crc = updateCrc(0xFFFFFFFFu, out.data() + typeOffset, out.size() - typeOffset);
+            appendBigEndian(out, crc ^ 0xFFFFFFFFu);
+        }
+
+        bool writeFile(const std::filesystem::path& path, const std::vector<uint8_t>& bytes) {
+            std::ofstream file(path, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            return static_cast<bool>(file);
+        }
+
+    } // namespace
+
+    void Framebuffer::resize(int newWidth, int newHeight) {
+        width = std::max(newWidth, 0);
+        height = std::max(newHeight, 0);
+        pixels.resize(size_t(width) * size_t(height));
+    }
+
+    void Framebuffer::clear(uint32_t color) {
+        std::fill(pixels.begin(), pixels.end(), color);
+    }
+
+    bool Framebuffer::writePpm(const std::filesystem::path& path) const {
+        std::string header = "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+        std::vector<uint8_t> bytes(header.begin(), header.end());
+        bytes.reserve(bytes.size() + pixels.size() * 3);
+        for (uint32_t pixel : pixels) {
+            bytes.push_back(static_cast<uint8_t>(pixel));
+            bytes.push_back(static_cast<uint8_t>(pixel >> 8));
+            bytes.push_back(static_cast<uint8_t>(pixel >> 16));
+        }
+        return writeFile(path, bytes);
+    }
+
+    bool Framebuffer::writePng(const std::filesystem::path& path) const {
+        static const uint8_t Signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        std::vector<uint8_t> bytes(Signature, Signature + 8);
+
+        std::vector<uint8_t> header;
+        appendBigEndian(header, static_cast<uint32_t>(width));
+        appendBigEndian(header, static_cast<uint32_t>(height));
+        header.insert(header.end(), {8, 6, 0, 0, 0}); // 8 bits, RGBA, deflate, adaptive filtering, no interlace
+        appendChunk(bytes, "IHDR", header);
+
+        // Scanlines with filter type 0, which is what the stored blocks carry
+        const size_t rowBytes = size_t(width) * 4;
+        std::vector<uint8_t> raw;
+        raw.reserve((rowBytes + 1) * size_t(height));
+        for (int y = 0; y < height; ++y) {
+            raw.push_back(0);
+            const auto* row = reinterpret_cast<const uint8_t*>(pixels.data() + size_t(y) * size_t(width));
+            raw.insert(raw.end(), row, row + rowBytes); // RGBA8 in memory order on little-endian hosts
+        }
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        for (size_t i = 0; i < raw.size();) {
+            if (i % (rowBytes + 1) == 0) {
+                ++i; // Filter byte
+                continue;
+            }
+            std::reverse(raw.begin() + static_cast<std::ptrdiff_t>(i), raw.begin() + static_cast<std::ptrdiff_t>(i + 4));
+            i += 4;
+        }
+#endif
+
+        // zlib stream of stored deflate blocks, each at most 65535 bytes
+        std::vector<uint8_t> zlib = {0x78, 0x01};
+        size_t offset = 0;
+        do {
+            const size_t blockSize = std::min<size_t>(raw.size() - offset, 65535);
+            const bool last = offset + blockSize == raw.size();
+            zlib.push_back(last ? 1 : 0);
+            zlib.push_back(static_cast<uint8_t>(blockSize));
+            zlib.push_back(static_cast<uint8_t>(blockSize >> 8));
+            zlib.push_back(static_cast<uint8_t>(~blockSize));
+            zlib.push_back(static_cast<uint8_t>(~blockSize >> 8));
+            zlib.insert(zlib.end(), raw.begin() + static_cast<std::ptrdiff_t>(offset), raw.begin() + static_cast<std::ptrdiff_t>(offset + blockSize));
+            offset += blockSize;
+        } while (offset < raw.size());
+
+        // Adler-32; 5552 bytes is the most that can be summed before b could overflow
+        uint32_t a = 1, b = 0;
+        for (size_t begin = 0; begin < raw.size(); begin += 5552) {
+            const size_t end = std::min<size_t>(begin + 5552, raw.size());
+            for (size_t i = begin; i < end; ++i) {
+                a += raw[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+        }
+        appendBigEndian(zlib, (b << 16) | a);
+        appendChunk(bytes, "IDAT", zlib);
+        appendChunk(bytes, "IEND", {});
+        return writeFile(path, bytes);
+    }
+
+    bool Framebuffer::write(const std::filesystem::path& path) const {
+        return path.extension() == ".png" ? writePng(path) : writePpm(path);
+    }
+
+} // namespace parteeengine::rendering::software
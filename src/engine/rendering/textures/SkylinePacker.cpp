@@ -0,0 +1,99 @@
+#include "engine/rendering/textures/SkylinePacker.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace parteeengine::rendering {
+
+    void SkylinePacker::reset(int width, int height) {
+        binWidth = std::max(width, 0);
+        binHeight = std::max(height, 0);
+        usedArea = 0;
+        skyline.clear();
+        if (binWidth > 0) {
+            skyline.push_back(Segment{0, 0, binWidth});
+        }
+    }
+
+    bool SkylinePacker::insert(int width, int height, int& x, int& y) {
+        if (width <= 0 || height <= 0) {
+            return false;
+        }
+
+        size_t best = skyline.size();
+        int bestBottom = std::numeric_limits<int>::max();
+        int bestWidth = std::numeric_limits<int>::max();
+        for (size_t i = 0; i < skyline.size(); ++i) {
+            const int top = fit(i, width, height);
+            if (top < 0) {
+                continue;
+            }
+            // Lowest bottom edge first; on a tie, the narrower segment wastes less
+            const int bottom = top + height;
+            if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestWidth)) {
+                best = i;
+                bestBottom = bottom;
+                bestWidth = skyline[i].width;
+            }
+        }
+        if (best == skyline.size()) {
+            return false;
+        }
+
+        x = skyline[best].x;
+        y = bestBottom - height;
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(best), Segment{x, bestBottom, width});
+
+        // Trim the segments the new one now covers
+        const int right = x + width;
+        for (size_t i = best + 1; i < skyline.size();) {
+            Segment& segment = skyline[i];
+            if (segment.x >= right) {
+                break;
+            }
+            const int covered = std::min(right - segment.x, segment.width);
+            segment.x += covered;
+            segment.width -= covered;
+            if (segment.width > 0) {
+                break;
+            }
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+
+        // Merge neighbours at the same height
+        for (size_t i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            } else {
+                ++i;
+            }
+        }
+
+        usedArea += uint64_t(width) * uint64_t(height);
+        return true;
+    }
+
+    float SkylinePacker::getOccupancy() const {
+        const uint64_t area = uint64_t(binWidth) * uint64_t(binHeight);
+        return area > 0 ? static_cast<float>(double(usedArea) / double(area)) : 0.f;
+    }
+
+    int SkylinePacker::fit(size_t index, int width, int height) const {
+        if (skyline[index].x + width > binWidth) {
+            return -1;
+        }
+        // The rectangle rests on the highest segment it spans
+        int top = 0;
+        int remaining = width;
+        for (size_t i = index; remaining > 0; ++i) {
+            top = std::max(top, skyline[i].y);
+            if (top + height > binHeight) {
+                return -1;
+            }
+            remaining -= skyline[i].width;
+        }
+        return top;
+    }
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,133 @@
+#include "engine/rendering/textures/TextureAtlas.hpp"
+
+#include "engine/core/profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <iostream>
+#include <numeric>
+
+namespace parteeengine::rendering {
+
+    TextureAtlas::~TextureAtlas() {
+        for (const Page& page : pages) {
+            TextureRegistry::destroy(page.texture);
+        }
+    }
+
+    TextureAtlas& TextureAtlas::setPageSize(int width, int height) {
+        pageWidth = std::max(width, 1);
+        pageHeight = std::max(height, 1);
+        return *this;
+    }
+
+    TextureAtlas& TextureAtlas::setPadding(int pixels) {
+        padding = std::max(pixels, 0);
+        return *this;
+    }
+
+    bool TextureAtlas::add(const Image& image) {
+        if (sprites.contains(image.name)) {
+            return true;
+        }
+        if (image.width <= 0 || image.height <= 0 || image.pixels.size() < size_t(image.width) * size_t(image.height)) {
+            std::cerr << "TextureAtlas: image " << image.name << " has no pixels\n";
+            return false;
+        }
+
+        const int paddedWidth = image.width + 2 * padding;
+        const int paddedHeight = image.height + 2 * padding;
+        int x = 0, y = 0;
+        Page* target = nullptr;
+        for (Page& page : pages) {
+            if (page.packer.insert(paddedWidth, paddedHeight, x, y)) {
+                target = &page;
+                break;
+            }
+        }
+        if (!target) {
+            if (paddedWidth > pageWidth || paddedHeight > pageHeight) {
+                std::cerr << "TextureAtlas: image " << image.name << " is larger than a " << pageWidth << "x" << pageHeight << " page\n";
+                return false;
+            }
+            Page& page = pages.emplace_back();
+            page.image.width = pageWidth;
+            page.image.height = pageHeight;
+            // A level-k texel spans 2^k pixels, so levels past log2(padding) would blend neighbouring sprites
+            page.image.maxMipLevel = padding > 0 ? static_cast<int>(std::bit_width(unsigned(padding))) - 1 : 0;
+            page.image.pixels.assign(size_t(pageWidth) * size_t(pageHeight), 0u);
+            page.packer.reset(pageWidth, pageHeight);
+            page.texture = TextureRegistry::create(page.image);
+            page.packer.insert(paddedWidth, paddedHeight, x, y);
+            target = &page;
+        }
+
+        blit(*target, image, x + padding, y + padding);
+        target->dirty = true;
+
+        const float width = static_cast<float>(target->image.width);
+        const float height = static_cast<float>(target->image.height);
+        AtlasSprite sprite;
+        sprite.texture = target->texture;
+        sprite.uv = UvRect{
+            static_cast<float>(x + padding) / width, static_cast<float>(y + padding) / height,
+            static_cast<float>(x + padding + image.width) / width, static_cast<float>(y + padding + image.height) / height
+        };
+        sprite.width = image.width;
+        sprite.height = image.height;
+        sprites.emplace(image.name, sprite);
+        return true;
+    }
+
+    size_t TextureAtlas::pack(std::span<const Image> images) {
+        PARTEE_PROFILE_ZONE("TextureAtlas::pack");
+        // Tallest first, then widest, keeps the skyline flat
+        std::vector<size_t> order(images.size());
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            if (images[a].height != images[b].height) {
+                return images[a].height > images[b].height;
+            }
+            return images[a].width > images[b].width;
+        });
+
+        size_t added = 0;
+        for (size_t index : order) {
+            added += add(images[index]) ? 1 : 0;
+        }
+        publish();
+        return added;
+    }
+
+    void TextureAtlas::publish() {
+        for (Page& page : pages) {
+            if (page.dirty) {
+                TextureRegistry::update(page.texture, page.image);
+                page.dirty = false;
+            }
+        }
+    }
+
+    const AtlasSprite* TextureAtlas::find(std::string_view name) const {
+        auto it = sprites.find(std::string(name));
+        return it != sprites.end() ? &it->second : nullptr;
+    }
+
+    void TextureAtlas::blit(Page& page, const Image& image, int x, int y) const {
+        // Each padded pixel takes the nearest image pixel, corners included
+        const int stride = page.image.width;
+        for (int row = -padding; row < image.height + padding; ++row) {
+            const int sourceRow = std::clamp(row, 0, image.height - 1);
+            const uint32_t* source = image.pixels.data() + size_t(sourceRow) * size_t(image.width);
+            uint32_t* target = page.image.pixels.data() + size_t(y + row) * size_t(stride) + size_t(x);
+            for (int column = -padding; column < 0; ++column) {
+                target[column] = source[0];
+            }
+            std::copy(source, source + image.width, target);
+            for (int column = image.width; column < image.width + padding; ++column) {
+                target[column] = source[image.width - 1];
+            }
+        }
+    }
+
+} // namespace parteeengine::rendering
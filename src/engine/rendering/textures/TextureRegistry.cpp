@@ -0,0 +1,40 @@
+#include "engine/rendering/textures/TextureRegistry.hpp"
+
+namespace parteeengine::rendering {
+
+    uint32_t TextureRegistry::create(TextureImage image) {
+        std::lock_guard lock(mutex);
+        const uint32_t id = nextId++;
+        textures[id] = Entry{std::make_shared<const TextureImage>(std::move(image)), nextVersion++};
+        return id;
+    }
+
+    bool TextureRegistry::update(uint32_t id, TextureImage image) {
+        auto shared = std::make_shared<const TextureImage>(std::move(image));
+        std::lock_guard lock(mutex);
+        auto it = textures.find(id);
+        if (it == textures.end()) {
+            return false;
+        }
+        it->second = Entry{std::move(shared), nextVersion++};
+        return true;
+    }
+
+    void TextureRegistry::destroy(uint32_t id) {
+        std::lock_guard lock(mutex);
+        textures.erase(id);
+    }
+
+    TextureRegistry::Entry TextureRegistry::get(uint32_t id) {
+        std::lock_guard lock(mutex);
+        auto it = textures.find(id);
+        return it != textures.end() ? it->second : Entry{};
+    }
+
+    uint64_t TextureRegistry::getVersion(uint32_t id) {
+        std::lock_guard lock(mutex);
+        auto it = textures.find(id);
+        return it != textures.end() ? it->second.version : 0;
+    }
+
+} // namespace parteeengine::rendering
@@ -1,6 +1,9 @@
 #include "engine/rendering/windows/IWindow.hpp"
 
+#include "engine/rendering/windows/OffscreenWindow.hpp"
+#if defined(_WIN32)
 #include "engine/rendering/windows/W32Window.hpp"
+#endif
 
 namespace parteeengine::rendering {
     std::unique_ptr<IWindow> IWindow::createPlatformWindow() {
@@ -8,7 +11,8 @@ namespace parteeengine::rendering {
             return std::make_unique<W32Window>();
         #elif defined(__linux__)
             // return std::make_unique<X11Window>();
-            static_assert(false, "Linux window not yet implemented");
+            // No display backend yet; render into memory
+            return std::make_unique<OffscreenWindow>();
         #elif defined(__APPLE__)
             // return std::make_unique<CocoaWindow>();
             static_assert(false, "macOS window not yet implemented");
@@ -16,4 +20,4 @@ namespace parteeengine::rendering {
             static_assert(false, "Unsupported platform");
         #endif
     }
-} // namespace parteeengine::rendering
\ No newline at end of file
+} // namespace parteeengine::rendering
@@ -0,0 +1,66 @@
+#include "engine/rendering/windows/NullWindow.hpp"
+
+namespace parteeengine::rendering {
+
+    bool NullWindow::create(const WindowConfig& config) {
+        this->windowConfig = config;
+        return this->create();
+    }
+
+    bool NullWindow::create() {
+        closeRequested = false;
+        return true;
+    }
+
+    bool NullWindow::destroy() {
+        return true;
+    }
+
+    bool NullWindow::show() {
+        return true;
+    }
+
+    bool NullWindow::hide() {
+        return true;
+    }
+
+    bool NullWindow::swapBuffers() {
+        return true;
+    }
+
+    bool NullWindow::pollEvents() {
+        return !closeRequested;
+    }
+
+    NativeGraphicsContext NullWindow::getNativeContext() const {
+        return NativeGraphicsContext{};
+    }
+
+    WindowConfig NullWindow::getConfig() const {
+        return windowConfig;
+    }
+
+    void NullWindow::config(WindowConfig config) {
+        this->windowConfig = config;
+    }
+
+    void NullWindow::setEventCallback(WindowEventCallback callback) {
+        eventCallback = callback;
+    }
+
+    void NullWindow::requestClose() {
+        closeRequested = true;
+        if (eventCallback) {
+            eventCallback(WindowEvent{WindowEvent::Type::Close});
+        }
+    }
+
+    void NullWindow::resize(int width, int height) {
+        windowConfig.width = width;
+        windowConfig.height = height;
+        if (eventCallback) {
+            eventCallback(WindowEvent{WindowEvent::Type::Resize, width, height});
+        }
+    }
+
+} // namespace parteeengine::rendering
@@ -0,0 +1,238 @@
+#include "engine/rendering/windows/OffscreenWindow.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace parteeengine::rendering {
+
+    OffscreenWindow::~OffscreenWindow() {
+        stopStreaming();
+    }
+
+    bool OffscreenWindow::create(const WindowConfig& config) {
+        windowConfig = config;
+        return create();
+    }
+
+    bool OffscreenWindow::create() {
+        closed = false;
+        presented = false;
+        presentedFrames = 0;
+        allocateBuffers();
+        if (sharedMemory) {
+            mapSharedMemory(); // Streaming was set up before the size was final
+        }
+        return true;
+    }
+
+    bool OffscreenWindow::destroy() {
+        stopStreaming();
+        buffers.clear();
+        surface = PixelSurface{};
+        return true;
+    }
+
+    bool OffscreenWindow::show() {
+        return true;
+    }
+
+    bool OffscreenWindow::hide() {
+        return true;
+    }
+
+    bool OffscreenWindow::swapBuffers() {
+        if (buffers.empty()) {
+            return false;
+        }
+        writeStreams(buffers[backBuffer]);
+        presented = true;
+        ++presentedFrames;
+        backBuffer = (backBuffer + 1) % buffers.size();
+        surface.pixels = buffers[backBuffer].data();
+        return true;
+    }
+
+    bool OffscreenWindow::pollEvents() {
+        {
+            std::lock_guard<std::mutex> lock(eventMutex);
+            handledEvents.swap(pendingEvents);
+        }
+        for (const WindowEvent& event : handledEvents) {
+            if (event.type == WindowEvent::Type::Resize) {
+                windowConfig.width = event.width;
+                windowConfig.height = event.height;
+                allocateBuffers();
+                if (sharedMemory) {
+                    mapSharedMemory(); // Sized for the new frames
+                }
+            } else if (event.type == WindowEvent::Type::Close) {
+                closed = true;
+            }
+            if (eventCallback) {
+                eventCallback(event);
+            }
+        }
+        handledEvents.clear();
+        return !closed;
+    }
+
+    NativeGraphicsContext OffscreenWindow::getNativeContext() const {
+        NativeGraphicsContext context;
+        context.windowHandle = const_cast<OffscreenWindow*>(this);
+        context.surface = buffers.empty() ? nullptr : &surface;
+        return context;
+    }
+
+    WindowConfig OffscreenWindow::getConfig() const {
+        return windowConfig;
+    }
+
+    void OffscreenWindow::config(WindowConfig config) {
+        windowConfig = config;
+    }
+
+    void OffscreenWindow::setEventCallback(WindowEventCallback callback) {
+        eventCallback = std::move(callback);
+    }
+
+    OffscreenWindow& OffscreenWindow::setBufferCount(size_t count) {
+        bufferCount = std::max<size_t>(count, 2);
+        return *this;
+    }
+
+    bool OffscreenWindow::streamToFile(const std::filesystem::path& path) {
+        fileStream.close();
+        fileStream.open(path, std::ios::binary | std::ios::trunc);
+        return fileStream.is_open();
+    }
+
+    bool OffscreenWindow::streamToSharedMemory(const std::string& name) {
+        unmapSharedMemory();
+        if (name != sharedMemoryName) {
+            unlinkSharedMemory();
+        }
+        sharedMemoryName = name;
+        if (!mapSharedMemory()) {
+            sharedMemoryName.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void OffscreenWindow::stopStreaming() {
+        fileStream.close();
+        unmapSharedMemory();
+        unlinkSharedMemory();
+        sharedMemoryName.clear();
+    }
+
+    void OffscreenWindow::postEvent(const WindowEvent& event) {
+        std::lock_guard<std::mutex> lock(eventMutex);
+        pendingEvents.push_back(event);
+    }
+
+    std::span<const uint32_t> OffscreenWindow::getFrontBuffer() const {
+        if (!presented || buffers.empty()) {
+            return {};
+        }
+        return buffers[(backBuffer + buffers.size() - 1) % buffers.size()];
+    }
+
+    void OffscreenWindow::allocateBuffers() {
+        const size_t pixelCount = size_t(std::max(windowConfig.width, 0)) * size_t(std::max(windowConfig.height, 0));
+        buffers.resize(bufferCount);
+        for (auto& buffer : buffers) {
+            buffer.assign(pixelCount, 0xFF000000u);
+        }
+        backBuffer = 0;
+        presented = false;
+        surface = PixelSurface{buffers[backBuffer].data(), windowConfig.width, windowConfig.height};
+    }
+
+    void OffscreenWindow::writeStreams(const std::vector<uint32_t>& frame) {
+        if (fileStream.is_open()) {
+            std::string header = "P6\n" + std::to_string(windowConfig.width) + " " + std::to_string(windowConfig.height) + "\n255\n";
+            fileBytes.assign(header.begin(), header.end());
+            fileBytes.reserve(header.size() + frame.size() * 3);
+            for (uint32_t pixel : frame) {
+                fileBytes.push_back(static_cast<uint8_t>(pixel));
+                fileBytes.push_back(static_cast<uint8_t>(pixel >> 8));
+                fileBytes.push_back(static_cast<uint8_t>(pixel >> 16));
+            }
+            fileStream.write(reinterpret_cast<const char*>(fileBytes.data()), static_cast<std::streamsize>(fileBytes.size()));
+            fileStream.flush();
+        }
+
+        if (sharedMemory) {
+            auto* header = static_cast<SharedFrameHeader*>(sharedMemory);
+            const uint64_t sequence = header->sequence.load(std::memory_order_relaxed);
+            header->sequence.store(sequence + 1, std::memory_order_relaxed); // Odd: writing
+            std::atomic_thread_fence(std::memory_order_release);
+            header->frameIndex = presentedFrames;
+            std::memcpy(reinterpret_cast<uint8_t*>(header) + sizeof(SharedFrameHeader), frame.data(), std::min(frame.size() * sizeof(uint32_t), sharedMemorySize - sizeof(SharedFrameHeader)));
+            header->sequence.store(sequence + 2, std::memory_order_release);
+        }
+    }
+
+    bool OffscreenWindow::mapSharedMemory() {
+#if defined(__unix__) || defined(__APPLE__)
+        unmapSharedMemory();
+        const size_t pixelBytes = size_t(std::max(windowConfig.width, 0)) * size_t(std::max(windowConfig.height, 0)) * sizeof(uint32_t);
+        const size_t size = sizeof(SharedFrameHeader) + pixelBytes;
+        int file = shm_open(sharedMemoryName.c_str(), O_CREAT | O_RDWR, 0644);
+        if (file < 0) {
+            return false;
+        }
+        if (ftruncate(file, static_cast<off_t>(size)) != 0) {
+            close(file);
+            return false;
+        }
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        if (memory == MAP_FAILED) {
+            close(file);
+            return false;
+        }
+
+        auto* header = new (memory) SharedFrameHeader{};
+        std::memcpy(header->magic, "PFRM", 4);
+        header->version = SharedFrameVersion;
+        header->width = static_cast<uint32_t>(std::max(windowConfig.width, 0));
+        header->height = static_cast<uint32_t>(std::max(windowConfig.height, 0));
+        sharedMemoryFile = file;
+        sharedMemory = memory;
+        sharedMemorySize = size;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void OffscreenWindow::unmapSharedMemory() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (sharedMemory) {
+            munmap(sharedMemory, sharedMemorySize);
+            close(sharedMemoryFile);
+        }
+#endif
+        sharedMemory = nullptr;
+        sharedMemoryFile = -1;
+        sharedMemorySize = 0;
+    }
+
+    void OffscreenWindow::unlinkSharedMemory() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (!sharedMemoryName.empty()) {
+            shm_unlink(sharedMemoryName.c_str());
+        }
+#endif
+    }
+
+} // namespace parteeengine::rendering
@@ -111,19 +111,19 @@ namespace parteeengine::rendering {
         return DefWindowProc(hwnd, msg, wParam, lParam);
     }
 
-    void W32Window::handleMessage([[maybe_unused]]UINT msg, [[maybe_unused]]WPARAM wParam, [[maybe_unused]]LPARAM lParam) {
-        // if (eventCallback) {
-        //     switch (msg) {
-        //         case WM_CLOSE:
-        //             eventCallback(WindowEvent{WindowEvent::Type::Close});
-        //             break;
-        //         case WM_SIZE:
-        //             eventCallback(WindowEvent{WindowEvent::Type::Resize});
-        //             break;
-        //         default:
-        //             break;
-        //     }
-        // }
+    void W32Window::handleMessage(UINT msg, [[maybe_unused]]WPARAM wParam, LPARAM lParam) {
+        if (eventCallback) {
+            switch (msg) {
+                case WM_CLOSE:
+                    eventCallback(WindowEvent{WindowEvent::Type::Close});
+                    break;
+                case WM_SIZE:
+                    eventCallback(WindowEvent{WindowEvent::Type::Resize, LOWORD(lParam), HIWORD(lParam)});
+                    break;
+                default:
+                    break;
+            }
+        }
     }
 
     WindowConfig W32Window::getConfig() const {
@@ -134,8 +134,8 @@ namespace parteeengine::rendering {
         this->windowConfig = config;
     }
 
-    // void W32Window::setEventCallback(WindowEventCallback callback) {
-    //     eventCallback = callback;
-    // }
+    void W32Window::setEventCallback(WindowEventCallback callback) {
+        eventCallback = callback;
+    }
 
 } // namespace parteeengine::rendering
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "engine/util/BatchMath.hpp"
+
+#include "engine/util/Simd.hpp"
+
+namespace parteeengine::simd {
+
+    void transformPoints(const Mat4& m, const float* x, const float* y, const float* z,
+                         float* outX, float* outY, float* outZ, size_t count) {
+        const float* e = m.data();
+        const Float4 m00 = set1(e[0]), m10 = set1(e[1]), m20 = set1(e[2]);
+        const Float4 m01 = set1(e[4]), m11 = set1(e[5]), m21 = set1(e[6]);
+        const Float4 m02 = set1(e[8]), m12 = set1(e[9]), m22 = set1(e[10]);
+        const Float4 m03 = set1(e[12]), m13 = set1(e[13]), m23 = set1(e[14]);
+        size_t i = 0;
+        for (; i + Width <= count; i += Width) {
+            const Float4 px = load(x + i), py = load(y + i), pz = load(z + i);
+            const Float4 rx = mulAdd(m02, pz, mulAdd(m01, py, mulAdd(m00, px, m03)));
+            const Float4 ry = mulAdd(m12, pz, mulAdd(m11, py, mulAdd(m10, px, m13)));
+            const Float4 rz = mulAdd(m22, pz, mulAdd(m21, py, mulAdd(m20, px, m23)));
+            store(outX + i, rx);
+            store(outY + i, ry);
+            store(outZ + i, rz);
+        }
+        for (; i < count; ++i) {
+            const float px = x[i], py = y[i], pz = z[i];
+            outX[i] = e[0] * px + e[4] * py + e[8] * pz + e[12];
+            outY[i] = e[1] * px + e[5] * py + e[9] * pz + e[13];
+            outZ[i] = e[2] * px + e[6] * py + e[10] * pz + e[14];
+        }
+    }
+
+    void transformPoints(const Mat3& m, const float* x, const float* y, float* outX, float* outY, size_t count) {
+        const float a = m(0, 0), b = m(1, 0), c = m(0, 1), d = m(1, 1), tx = m(0, 2), ty = m(1, 2);
+        const Float4 va = set1(a), vb = set1(b), vc = set1(c), vd = set1(d), vtx = set1(tx), vty = set1(ty);
+        size_t i = 0;
+        for (; i + Width <= count; i += Width) {
+            const Float4 px = load(x + i), py = load(y + i);
+            store(outX + i, mulAdd(vc, py, mulAdd(va, px, vtx)));
+            store(outY + i, mulAdd(vd, py, mulAdd(vb, px, vty)));
+        }
+        for (; i < count; ++i) {
+            const float px = x[i], py = y[i];
+            outX[i] = a * px + c * py + tx;
+            outY[i] = b * px + d * py + ty;
+        }
+    }
+
+} // namespace parteeengine::simd
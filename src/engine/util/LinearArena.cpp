@@ -0,0 +1,55 @@
+#include "engine/util/LinearArena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace parteeengine {
+
+    LinearArena::LinearArena(size_t initialCapacity) {
+        addBlock(std::max<size_t>(initialCapacity, 1));
+    }
+
+    void* LinearArena::allocate(size_t bytes, size_t align) {
+        auto address = reinterpret_cast<uintptr_t>(cursor);
+        size_t padding = (align - (address & (align - 1))) & (align - 1);
+        if (bytes + padding > static_cast<size_t>(end - cursor)) {
+            // Room for the request at any alignment; blocks grow geometrically
+            addBlock(std::max(bytes + align, blocks.back().size * 2));
+            address = reinterpret_cast<uintptr_t>(cursor);
+            padding = (align - (address & (align - 1))) & (align - 1);
+        }
+        std::byte* result = cursor + padding;
+        cursor = result + bytes;
+        used += padding + bytes;
+        return result;
+    }
+
+    void LinearArena::reset() {
+        if (blocks.size() > 1) {
+            size_t total = getCapacity();
+            blocks.clear();
+            addBlock(total);
+        }
+        cursor = blocks.back().memory.get();
+        end = cursor + blocks.back().size;
+        used = 0;
+    }
+
+    size_t LinearArena::getCapacity() const {
+        size_t total = 0;
+        for (const Block& block : blocks) {
+            total += block.size;
+        }
+        return total;
+    }
+
+    void LinearArena::addBlock(size_t minimumSize) {
+        Block block;
+        block.memory = std::make_unique_for_overwrite<std::byte[]>(minimumSize);
+        block.size = minimumSize;
+        cursor = block.memory.get();
+        end = cursor + minimumSize;
+        blocks.push_back(std::move(block));
+    }
+
+} // namespace parteeengine
@@ -0,0 +1,149 @@
+#include "engine/util/Lz4.hpp"
+
+#include <cstring>
+
+namespace parteeengine::lz4 {
+
+    namespace {
+
+        constexpr size_t MinMatch = 4;
+        constexpr size_t LastLiterals = 5;   // The block must end with at least this many literals
+        constexpr size_t MatchSearchLimit = 12; // No match may start this close to the end
+        constexpr size_t MaxOffset = 65535;
+        constexpr int HashBits = 16;
+
+        uint32_t read32(const uint8_t* p) {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        uint32_t hash(uint32_t sequence) {
+            return (sequence * 2654435761u) >> (32 - HashBits);
+        }
+
+        // Writes the 255-continued remainder of a length that overflowed its 4-bit token field.
+        void writeLength(std::vector<uint8_t>& out, size_t length) {
+            while (length >= 255) {
+                out.push_back(255);
+                length -= 255;
+            }
+            out.push_back(static_cast<uint8_t>(length));
+        }
+
+        void writeSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength) {
+            size_t tokenPos = out.size();
+            out.push_back(0);
+            uint8_t token = 0;
+
+            if (literalLength >= 15) {
+                token = 15 << 4;
+                writeLength(out, literalLength - 15);
+            } else {
+                token = static_cast<uint8_t>(literalLength << 4);
+            }
+            out.insert(out.end(), literals, literals + literalLength);
+
+            if (matchLength > 0) {
+                out.push_back(static_cast<uint8_t>(offset & 0xFF));
+                out.push_back(static_cast<uint8_t>(offset >> 8));
+                size_t code = matchLength - MinMatch;
+                if (code >= 15) {
+                    token |= 15;
+                    writeLength(out, code - 15);
+                } else {
+                    token |= static_cast<uint8_t>(code);
+                }
+            }
+            out[tokenPos] = token;
+        }
+
+        // Reads a 255-continued length extension. Returns false if the input ends first.
+        bool readLength(const uint8_t* src, size_t srcSize, size_t& ip, size_t& length) {
+            uint8_t byte;
+            do {
+                if (ip >= srcSize) return false;
+                byte = src[ip++];
+                length += byte;
+            } while (byte == 255);
+            return true;
+        }
+
+    } // namespace
+
+    size_t compress(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out) {
+        size_t start = out.size();
+        out.reserve(start + compressBound(srcSize));
+
+        size_t anchor = 0;
+        if (srcSize > MatchSearchLimit) {
+            std::vector<uint32_t> table(size_t(1) << HashBits, 0);
+            size_t ip = 0;
+            const size_t searchEnd = srcSize - MatchSearchLimit;
+            const size_t matchEnd = srcSize - LastLiterals;
+
+            while (ip < searchEnd) {
+                uint32_t sequence = read32(src + ip);
+                uint32_t& slot = table[hash(sequence)];
+                size_t candidate = slot;
+                slot = static_cast<uint32_t>(ip);
+
+                if (candidate < ip && ip - candidate <= MaxOffset && read32(src + candidate) == sequence) {
+                    size_t length = MinMatch;
+                    while (ip + length < matchEnd && src[candidate + length] == src[ip + length]) {
+                        ++length;
+                    }
+                    writeSequence(out, src + anchor, ip - anchor, ip - candidate, length);
+                    ip += length;
+                    anchor = ip;
+                } else {
+                    ++ip;
+                }
+            }
+        }
+        writeSequence(out, src + anchor, srcSize - anchor, 0, 0);
+        return out.size() - start;
+    }
+
+    bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+        size_t ip = 0;
+        size_t op = 0;
+        while (ip < srcSize) {
+            uint8_t token = src[ip++];
+
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !readLength(src, srcSize, ip, literalLength)) return false;
+            if (literalLength > srcSize - ip || literalLength > dstSize - op) return false;
+            if (literalLength > 0) {
+                std::memcpy(dst + op, src + ip, literalLength);
+            }
+            ip += literalLength;
+            op += literalLength;
+
+            if (ip == srcSize) break; // The last sequence has no match
+
+            if (srcSize - ip < 2) return false;
+            size_t offset = src[ip] | (static_cast<size_t>(src[ip + 1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > op) return false;
+
+            size_t matchLength = token & 15;
+            if (matchLength == 15 && !readLength(src, srcSize, ip, matchLength)) return false;
+            matchLength += MinMatch;
+            if (matchLength > dstSize - op) return false;
+
+            // Matches may overlap their own output, so copy forwards byte by byte unless they can't
+            const uint8_t* match = dst + op - offset;
+            if (offset >= matchLength) {
+                std::memcpy(dst + op, match, matchLength);
+            } else {
+                for (size_t i = 0; i < matchLength; ++i) {
+                    dst[op + i] = match[i];
+                }
+            }
+            op += matchLength;
+        }
+        return op == dstSize;
+    }
+
+} // namespace parteeengine::lz4
@@ -0,0 +1,76 @@
+#include "engine/util/Mat3.hpp"
+
+#include <cmath>
+#include <numbers>
+
+namespace parteeengine {
+
+    Mat3 Mat3::translation(const Vector2& offset) {
+        return Mat3({1, 0, 0}, {0, 1, 0}, {offset.x, offset.y, 1});
+    }
+
+    Mat3 Mat3::scale(const Vector2& factors) {
+        return Mat3({factors.x, 0, 0}, {0, factors.y, 0}, {0, 0, 1});
+    }
+
+    Mat3 Mat3::rotation(float degrees) {
+        const float radians = degrees * std::numbers::pi_v<float> / 180.f;
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        return Mat3({c, s, 0}, {-s, c, 0}, {0, 0, 1});
+    }
+
+    Mat3 Mat3::transform2d(const Vector2& position, float degrees, const Vector2& scale) {
+        const float radians = degrees * std::numbers::pi_v<float> / 180.f;
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        return Mat3({scale.x * c, scale.x * s, 0}, {-scale.y * s, scale.y * c, 0}, {position.x, position.y, 1});
+    }
+
+    float Mat3::determinant() const {
+        const Mat3& m = *this;
+        return m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1))
+             - m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0))
+             + m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+    }
+
+    Mat3 Mat3::transposed() const {
+        Mat3 result;
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 3; ++column) {
+                result(column, row) = (*this)(row, column);
+            }
+        }
+        return result;
+    }
+
+    Mat3 Mat3::inverse() const {
+        const float det = determinant();
+        if (det == 0.f || !std::isfinite(det)) {
+            return Mat3();
+        }
+        const float d = 1.f / det;
+        const Mat3& m = *this;
+        Mat3 result;
+        result(0, 0) = (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) * d;
+        result(0, 1) = (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * d;
+        result(0, 2) = (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * d;
+        result(1, 0) = (m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2)) * d;
+        result(1, 1) = (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * d;
+        result(1, 2) = (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * d;
+        result(2, 0) = (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0)) * d;
+        result(2, 1) = (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * d;
+        result(2, 2) = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * d;
+        return result;
+    }
+
+    Mat4 Mat3::toMat4() const {
+        const Mat3& m = *this;
+        return Mat4(
+            {m(0, 0), m(1, 0), 0, m(2, 0)},
+            {m(0, 1), m(1, 1), 0, m(2, 1)},
+            {0, 0, 1, 0},
+            {m(0, 2), m(1, 2), 0, m(2, 2)});
+    }
+
+} // namespace parteeengine
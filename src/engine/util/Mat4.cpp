@@ -0,0 +1,93 @@
+#include "engine/util/Mat4.hpp"
+
+#include <cmath>
+#include <numbers>
+
+namespace parteeengine {
+
+    Mat4 Mat4::translation(const Vector3& offset) {
+        Mat4 result;
+        result.columns[3] = Vector4(offset, 1.f);
+        return result;
+    }
+
+    Mat4 Mat4::scale(const Vector3& factors) {
+        return Mat4({factors.x, 0, 0, 0}, {0, factors.y, 0, 0}, {0, 0, factors.z, 0}, {0, 0, 0, 1});
+    }
+
+    Mat4 Mat4::rotationZ(float degrees) {
+        const float radians = degrees * std::numbers::pi_v<float> / 180.f;
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        return Mat4({c, s, 0, 0}, {-s, c, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1});
+    }
+
+    Mat4 Mat4::orthographic(float left, float right, float bottom, float top, float near, float far) {
+        const float width = right - left;
+        const float height = top - bottom;
+        const float depth = far - near;
+        return Mat4(
+            {2.f / width, 0, 0, 0},
+            {0, 2.f / height, 0, 0},
+            {0, 0, -2.f / depth, 0},
+            {-(right + left) / width, -(top + bottom) / height, -(far + near) / depth, 1});
+    }
+
+    Mat4 Mat4::transposed() const {
+        Mat4 result;
+        for (int row = 0; row < 4; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                result(column, row) = (*this)(row, column);
+            }
+        }
+        return result;
+    }
+
+    Mat4 Mat4::inverse() const {
+        // Cofactor expansion through the 2x2 minors of the top and bottom row pairs
+        const float* m = data();
+        const float a00 = m[0], a01 = m[4], a02 = m[8], a03 = m[12];
+        const float a10 = m[1], a11 = m[5], a12 = m[9], a13 = m[13];
+        const float a20 = m[2], a21 = m[6], a22 = m[10], a23 = m[14];
+        const float a30 = m[3], a31 = m[7], a32 = m[11], a33 = m[15];
+
+        const float s0 = a00 * a11 - a10 * a01;
+        const float s1 = a00 * a12 - a10 * a02;
+        const float s2 = a00 * a13 - a10 * a03;
+        const float s3 = a01 * a12 - a11 * a02;
+        const float s4 = a01 * a13 - a11 * a03;
+        const float s5 = a02 * a13 - a12 * a03;
+        const float c5 = a22 * a33 - a32 * a23;
+        const float c4 = a21 * a33 - a31 * a23;
+        const float c3 = a21 * a32 - a31 * a22;
+        const float c2 = a20 * a33 - a30 * a23;
+        const float c1 = a20 * a32 - a30 * a22;
+        const float c0 = a20 * a31 - a30 * a21;
+
+        const float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        if (determinant == 0.f || !std::isfinite(determinant)) {
+            return Mat4();
+        }
+        const float d = 1.f / determinant;
+
+        Mat4 result;
+        result(0, 0) = ( a11 * c5 - a12 * c4 + a13 * c3) * d;
+        result(0, 1) = (-a01 * c5 + a02 * c4 - a03 * c3) * d;
+        result(0, 2) = ( a31 * s5 - a32 * s4 + a33 * s3) * d;
+        result(0, 3) = (-a21 * s5 + a22 * s4 - a23 * s3) * d;
+        result(1, 0) = (-a10 * c5 + a12 * c2 - a13 * c1) * d;
+        result(1, 1) = ( a00 * c5 - a02 * c2 + a03 * c1) * d;
+        result(1, 2) = (-a30 * s5 + a32 * s2 - a33 * s1) * d;
+        result(1, 3) = ( a20 * s5 - a22 * s2 + a23 * s1) * d;
+        result(2, 0) = ( a10 * c4 - a11 * c2 + a13 * c0) * d;
+        result(2, 1) = (-a00 * c4 + a01 * c2 - a03 * c0) * d;
+        result(2, 2) = ( a30 * s4 - a31 * s2 + a33 * s0) * d;
+        result(2, 3) = (-a20 * s4 + a21 * s2 - a23 * s0) * d;
+        result(3, 0) = (-a10 * c3 + a11 * c1 - a12 * c0) * d;
+        result(3, 1) = ( a00 * c3 - a01 * c1 + a02 * c0) * d;
+        result(3, 2) = (-a30 * s3 + a31 * s1 - a32 * s0) * d;
+        result(3, 3) = ( a20 * s3 - a21 * s1 + a22 * s0) * d;
+        return result;
+    }
+
+} // namespace parteeengine
@@ -0,0 +1,57 @@
+#include "engine/util/TypeName.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
+
+namespace parteeengine {
+
+    namespace {
+
+        std::string makeReadable(const char* name) {
+            std::string readable = name;
+#if __has_include(<cxxabi.h>)
+            int status = 0;
+            if (char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status)) {
+                readable = demangled;
+                std::free(demangled);
+            }
+#endif
+            // MSVC's names are readable already, but spell out the class key
+            for (std::string_view key : {"struct ", "class "}) {
+                for (size_t at = readable.find(key); at != std::string::npos; at = readable.find(key, at)) {
+                    readable.erase(at, key.size());
+                }
+            }
+            // Drop every qualifier: a::b::C becomes C, template arguments included
+            for (size_t at = readable.find("::"); at != std::string::npos; at = readable.find("::", at)) {
+                size_t start = at;
+                while (start > 0 && (std::isalnum(static_cast<unsigned char>(readable[start - 1])) || readable[start - 1] == '_')) {
+                    --start;
+                }
+                readable.erase(start, at + 2 - start);
+                at = start;
+            }
+            return readable;
+        }
+
+    } // namespace
+
+    const char* readableTypeName(std::type_index type) {
+        static std::mutex mutex;
+        static std::unordered_map<std::type_index, std::string> names; // Nodes never move, so c_str() stays put
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = names.find(type);
+        if (it == names.end()) {
+            it = names.emplace(type, makeReadable(type.name())).first;
+        }
+        return it->second.c_str();
+    }
+
+} // namespace parteeengine
@@ -1,15 +1,28 @@
 #include "engine/core/Engine.hpp"
+#include "engine/core/profiling/Profiler.hpp"
 
 #include "engine/input/InputSystem.hpp"
-#include "engine/input/devices/Keyboard.hpp"
 
 #include "engine/core/modules/BehaviorModule.hpp"
+#include "engine/particles/ParticleModule.hpp"
 #include "engine/rendering/core/RenderModule.hpp"
+#include "engine/rendering/renderers/NullRenderer.hpp"
+#include "engine/rendering/renderers/SoftwareRenderer.hpp"
+#include "engine/rendering/windows/NullWindow.hpp"
+#include "engine/rendering/windows/OffscreenWindow.hpp"
+#if defined(_WIN32)
+#include "engine/input/devices/Keyboard.hpp"
 #include "engine/rendering/renderers/OpenGLRenderer.hpp"
+#endif
 
 #include "engine/core/entities/BehaviorComponent.hpp"
 #include "engine/core/entities/TransformComponent2d.hpp"
+#include "engine/rendering/renderables/RenderMesh.hpp"
+#include "engine/rendering/renderables/RenderMeshLod.hpp"
+#include "engine/rendering/renderables/RenderParticles.hpp"
 #include "engine/rendering/renderables/RenderQuad.hpp"
+#include "engine/rendering/renderables/RenderSprite.hpp"
+#include "engine/rendering/textures/TextureAtlas.hpp"
 
 #include "engine/interpreter/Lexer.hpp"
 #include "engine/interpreter/Parser.hpp"
@@ -17,26 +30,168 @@
 #include "engine/interpreter/ScriptLoader.hpp"
 #include "engine/interpreter/AST.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <random>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 using namespace parteeengine;
 
-int engine() {
+// The command types the engine ships and their handlers, dispatched at compile time
+using SoftwareHandlers = rendering::RenderHandlers<
+    rendering::RenderBinding<rendering::QuadRenderCommand, rendering::RenderQuadComponent::SoftwareHandler>,
+    rendering::RenderBinding<rendering::StaticQuadBatchCommand, rendering::RenderQuadComponent::StaticBatchSoftwareHandler>,
+    rendering::RenderBinding<rendering::MeshRenderCommand, rendering::RenderMeshComponent::SoftwareHandler>,
+    rendering::RenderBinding<rendering::ParticleBatchRenderCommand, rendering::RenderParticles::SoftwareHandler>>;
+#if defined(PARTEE_GL_CORE)
+using GLCoreHandlers = rendering::RenderHandlers<
+    rendering::RenderBinding<rendering::QuadRenderCommand, rendering::RenderQuadComponent::GLCoreHandler>,
+    rendering::RenderBinding<rendering::StaticQuadBatchCommand, rendering::RenderQuadComponent::StaticBatchGLCoreHandler>,
+    rendering::RenderBinding<rendering::MeshRenderCommand, rendering::RenderMeshComponent::GLCoreHandler>,
+    rendering::RenderBinding<rendering::ParticleBatchRenderCommand, rendering::RenderParticles::GLCoreHandler>>;
+#endif
+#if defined(_WIN32)
+using OpenGLHandlers = rendering::RenderHandlers<
+    rendering::RenderBinding<rendering::QuadRenderCommand, rendering::RenderQuadComponent::OpenGLHandler>,
+    rendering::RenderBinding<rendering::StaticQuadBatchCommand, rendering::RenderQuadComponent::StaticBatchOpenGLHandler>,
+    rendering::RenderBinding<rendering::ParticleBatchRenderCommand, rendering::RenderParticles::OpenGLHandler>>;
+#endif
+
+struct LaunchOptions {
+    bool headless = false;  // Gather render commands but never draw them
+    bool glCore = false;    // Draw with the OpenGL 3.3 core renderer
+    bool software = false;  // Draw with the CPU rasterizer
+    std::string screenshotPath; // Software renderer: write the last frame here (.png or .ppm)
+    std::string streamPath;     // Offscreen window: append every frame here as a binary PPM
+    std::string sharedMemoryName; // Offscreen window: publish every frame to this shared memory object
+    uint64_t frameLimit = 0; // 0 runs until stopped
+    std::string recordPath;  // Replay log to record, if any
+    std::string tracePath;   // Render trace to record for parteereplay, if any
+    uint64_t traceFrames = 0; // Frames to trace, 0 for all
+    std::string replayPath;  // Replay log to play back, if any
+    std::vector<std::string> packPaths; // Asset packs to mount, later ones take precedence
+    std::string profilePath; // Chrome trace of the profiler zones to write at shutdown, if any
+};
+
+// size x size white image with the pixels where inside(x, y) holds opaque, x and y in [-1, 1].
+template<typename Inside>
+std::vector<uint32_t> makeShape(int size, Inside inside) {
+    std::vector<uint32_t> pixels(size_t(size) * size, 0x00FFFFFFu);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            const float u = (x + 0.5f) / size * 2.f - 1.f;
+            const float v = (y + 0.5f) / size * 2.f - 1.f;
+            if (inside(u, v)) {
+                pixels[size_t(y) * size + x] = 0xFFFFFFFFu;
+            }
+        }
+    }
+    return pixels;
+}
+
+int engine(LaunchOptions options) {
     Engine engine;
+    const bool headless = options.headless;
+
+    // Mount before anything requests assets, so they resolve from the packs
+    for (const auto& packPath : options.packPaths) {
+        if (!engine.getAssetManager().mount(packPath)) {
+            std::cerr << "Failed to mount asset pack " << packPath << "\n";
+            return 1;
+        }
+    }
+
+    // Off Windows the drawing renderers present into memory; frames can be streamed out from there
+    std::unique_ptr<rendering::IWindow> window = rendering::IWindow::createPlatformWindow();
+    if (auto* offscreen = dynamic_cast<rendering::OffscreenWindow*>(window.get())) {
+        if (!options.streamPath.empty() && !offscreen->streamToFile(options.streamPath)) {
+            std::cerr << "Failed to open frame stream " << options.streamPath << "\n";
+            return 1;
+        }
+        if (!options.sharedMemoryName.empty() && !offscreen->streamToSharedMemory(options.sharedMemoryName)) {
+            std::cerr << "Failed to create shared memory " << options.sharedMemoryName << "\n";
+            return 1;
+        }
+    } else if (!options.streamPath.empty() || !options.sharedMemoryName.empty()) {
+        std::cerr << "Frames can only be streamed from an offscreen window, ignoring --stream and --shared-memory\n";
+    }
+
+    // Whichever render module gets created records the trace
+    bool traceFailed = false;
+    auto recordTrace = [&](auto& renderModule) {
+        if (!options.tracePath.empty() && !renderModule.recordTrace(options.tracePath, options.traceFrames)) {
+            std::cerr << "Failed to create render trace " << options.tracePath << "\n";
+            traceFailed = true;
+        }
+    };
 
     engine.createModule<BehaviorModule>();
-    engine.createModule<rendering::RenderModule<rendering::OpenGLRenderer>>()
-        .registerComponent<rendering::QuadRenderCommand>(
-            rendering::RenderQuadComponent::gatherer(),
-            rendering::RenderQuadComponent::openGLHandler()
-        );
+    engine.createModule<particles::ParticleModule>();
+    bool drawing = false; // Whether a renderer that draws was created
+#if defined(PARTEE_GL_CORE)
+    if (!headless && options.glCore) {
+        auto& renderModule = engine.createModule<rendering::RenderModule<rendering::GLCoreRenderer, GLCoreHandlers>>()
+            .useWindow(std::move(window))
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderQuadComponent::gatherer())
+            .registerCommand<rendering::StaticQuadBatchCommand>()
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderSpriteComponent::gatherer())
+            .registerComponent<rendering::MeshRenderCommand>(rendering::RenderMeshComponent::gatherer())
+            .registerComponent<rendering::MeshRenderCommand>(rendering::RenderMeshLodComponent::gatherer())
+            .registerComponent<rendering::ParticleBatchRenderCommand>(rendering::RenderParticles::gatherer());
+        // Shaders resolve like any other asset, so mounted packs apply to them
+        renderModule.getRenderer().setFileSystem(&engine.getAssetManager().getFileSystem());
+        recordTrace(renderModule);
+        drawing = true;
+    }
+#else
+    if (options.glCore) {
+        std::cerr << "Built without the OpenGL core renderer, ignoring --gl-core\n";
+    }
+#endif
+    rendering::RenderModule<rendering::SoftwareRenderer, SoftwareHandlers>* softwareModule = nullptr;
+    if (!headless && !drawing && options.software) {
+        softwareModule = &engine.createModule<rendering::RenderModule<rendering::SoftwareRenderer, SoftwareHandlers>>()
+            .useWindow(std::move(window))
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderQuadComponent::gatherer())
+            .registerCommand<rendering::StaticQuadBatchCommand>()
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderSpriteComponent::gatherer())
+            .registerComponent<rendering::MeshRenderCommand>(rendering::RenderMeshComponent::gatherer())
+            .registerComponent<rendering::MeshRenderCommand>(rendering::RenderMeshLodComponent::gatherer())
+            .registerComponent<rendering::ParticleBatchRenderCommand>(rendering::RenderParticles::gatherer());
+        recordTrace(*softwareModule);
+        drawing = true;
+    }
+#if defined(_WIN32)
+    if (!headless && !drawing) {
+        auto& renderModule = engine.createModule<rendering::RenderModule<rendering::OpenGLRenderer, OpenGLHandlers>>()
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderQuadComponent::gatherer())
+            .registerCommand<rendering::StaticQuadBatchCommand>()
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderSpriteComponent::gatherer())
+            .registerComponent<rendering::ParticleBatchRenderCommand>(rendering::RenderParticles::gatherer());
+        recordTrace(renderModule);
+        drawing = true;
+    }
+    if (!headless) {
+        input::InputSystem::registerDevice<input::Keyboard>();
+    }
+#endif
+    if (!drawing) {
+        auto& renderModule = engine.createModule<rendering::RenderModule<rendering::NullRenderer>>()
+            .useWindow(std::make_unique<rendering::NullWindow>())
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderQuadComponent::gatherer())
+            .registerCommand<rendering::StaticQuadBatchCommand>()
+            .registerComponent<rendering::QuadRenderCommand>(rendering::RenderSpriteComponent::gatherer())
+            .registerComponent<rendering::ParticleBatchRenderCommand>(rendering::RenderParticles::gatherer());
+        recordTrace(renderModule);
+    }
+    if (traceFailed) {
+        return 1;
+    }
 
     engine.addScript("assets/scripts/exampleCode.par");
 
-    input::InputSystem::registerDevice<input::Keyboard>();
-
     // Random number generators for positions and colors
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -52,16 +207,106 @@ int engine() {
         engine.addComponent<TransformComponent2d>(entity) 
             = {posDistX(gen), posDistY(gen)};
         
-        // Add render component with random color
-        engine.addComponent<rendering::RenderQuadComponent>(entity)
+        // Add render component with random color; most never move, so they're drawn from static batches
+        auto& quad = engine.addComponent<rendering::RenderQuadComponent>(entity)
             = {{colorDist(gen), colorDist(gen), colorDist(gen), 1.f}};
+        quad.isStatic = i % 10 != 0;
+    }
+
+    // A few sprite shapes packed into one atlas page, so every sprite draws in one batch
+    const std::vector<uint32_t> disc = makeShape(32, [](float u, float v) { return u * u + v * v <= 1.f; });
+    const std::vector<uint32_t> ring = makeShape(48, [](float u, float v) { float r = u * u + v * v; return r <= 1.f && r >= 0.5f; });
+    const std::vector<uint32_t> diamond = makeShape(24, [](float u, float v) { return std::abs(u) + std::abs(v) <= 1.f; });
+    const rendering::TextureAtlas::Image shapes[] = {
+        {"disc", disc, 32, 32},
+        {"ring", ring, 48, 48},
+        {"diamond", diamond, 24, 24},
+    };
+    rendering::TextureAtlas atlas;
+    atlas.pack(shapes);
+
+    for (int i = 0; i < 300; ++i) {
+        Entity entity = engine.createEntity();
+        engine.addComponent<TransformComponent2d>(entity)
+            = {{posDistX(gen), posDistY(gen)}, 0.f, {32.f, 32.f}};
+        auto& sprite = engine.addComponent<rendering::RenderSpriteComponent>(entity)
+            = {*atlas.find(shapes[i % 3].name), {colorDist(gen), colorDist(gen), colorDist(gen), 1.f}};
+        sprite.layer = 1;
+    }
+
+    // A fountain of particles in the middle of the window, drawn above the quads
+    Entity fountain = engine.createEntity();
+    engine.addComponent<TransformComponent2d>(fountain) = {400.f, 300.f};
+    auto& emitter = engine.addComponent<particles::ParticleEmitter>(fountain) = particles::ParticleEmitter(400.f, 1024);
+    emitter.startColor = {1.f, 0.9f, 0.3f, 1.f};
+    emitter.endColor = {1.f, 0.2f, 0.f, 0.f};
+    emitter.acceleration = {0.f, 150.f};
+    emitter.size = 6.f;
+
+    if (!options.replayPath.empty() && !engine.playReplay(options.replayPath)) {
+        std::cerr << "Failed to open replay " << options.replayPath << "\n";
+        return 1;
+    }
+    if (!options.recordPath.empty() && !engine.recordReplay(options.recordPath)) {
+        std::cerr << "Failed to create replay " << options.recordPath << "\n";
+        return 1;
+    }
+
+    if (options.frameLimit > 0) {
+        engine.runFrames(options.frameLimit);
+    } else {
+        engine.run();
+    }
+
+    if (softwareModule && !options.screenshotPath.empty()
+        && !softwareModule->getRenderer().getFramebuffer().write(options.screenshotPath)) {
+        std::cerr << "Failed to write screenshot " << options.screenshotPath << "\n";
+        return 1;
+    }
+
+    // Zones the profiler still holds, which covers the last frames of a long run
+    if (!options.profilePath.empty() && !profiling::Profiler::exportChromeTrace(options.profilePath)) {
+        std::cerr << "Failed to write profile " << options.profilePath << "\n";
+        return 1;
     }
 
-    engine.run();
-    
     return 0;
 }
 
-int main() {
-    return engine();
+// Usage: parteeeengine [--headless | --gl-core | --software [--screenshot FILE]] [--stream FILE] [--shared-memory NAME]
+//                      [--frames N] [--record FILE | --replay FILE] [--trace FILE [--trace-frames N]] [--pack FILE]...
+//                      [--profile FILE]
+int main(int argc, char** argv) {
+    LaunchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            options.headless = true;
+        } else if (arg == "--gl-core") {
+            options.glCore = true;
+        } else if (arg == "--software") {
+            options.software = true;
+        } else if (arg == "--screenshot" && i + 1 < argc) {
+            options.screenshotPath = argv[++i];
+        } else if (arg == "--stream" && i + 1 < argc) {
+            options.streamPath = argv[++i];
+        } else if (arg == "--shared-memory" && i + 1 < argc) {
+            options.sharedMemoryName = argv[++i];
+        } else if (arg == "--frames" && i + 1 < argc) {
+            options.frameLimit = std::stoull(argv[++i]);
+        } else if (arg == "--record" && i + 1 < argc) {
+            options.recordPath = argv[++i];
+        } else if (arg == "--replay" && i + 1 < argc) {
+            options.replayPath = argv[++i];
+        } else if (arg == "--trace" && i + 1 < argc) {
+            options.tracePath = argv[++i];
+        } else if (arg == "--trace-frames" && i + 1 < argc) {
+            options.traceFrames = std::stoull(argv[++i]);
+        } else if (arg == "--pack" && i + 1 < argc) {
+            options.packPaths.push_back(argv[++i]);
+        } else if (arg == "--profile" && i + 1 < argc) {
+            options.profilePath = argv[++i];
+        }
+    }
+    return engine(options);
 }
\ No newline at end of file
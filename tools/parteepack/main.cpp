@@ -0,0 +1,48 @@
+#include "engine/assets/AssetPack.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace parteeengine;
+
+// Usage: parteepack [--compress] [--base DIR] OUTPUT INPUT...
+// Every file under each INPUT directory is stored under its path relative to the
+// base directory (default: the working directory), e.g. "assets/scripts/x.par".
+int main(int argc, char** argv) {
+    bool compress = false;
+    std::filesystem::path base = ".";
+    std::vector<std::filesystem::path> positional;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--compress") {
+            compress = true;
+        } else if (arg == "--base" && i + 1 < argc) {
+            base = argv[++i];
+        } else {
+            positional.emplace_back(arg);
+        }
+    }
+    if (positional.size() < 2) {
+        std::cerr << "Usage: parteepack [--compress] [--base DIR] OUTPUT INPUT...\n";
+        return 1;
+    }
+
+    assets::AssetPackWriter writer;
+    writer.setCompression(compress);
+    for (size_t i = 1; i < positional.size(); ++i) {
+        if (!std::filesystem::is_directory(positional[i])) {
+            std::cerr << "Not a directory: " << positional[i].string() << "\n";
+            return 1;
+        }
+        writer.addDirectory(positional[i], base);
+    }
+
+    if (!writer.write(positional[0])) {
+        std::cerr << "Failed to write " << positional[0].string() << "\n";
+        return 1;
+    }
+    std::cout << "Packed " << writer.getEntryCount() << " files into " << positional[0].string() << "\n";
+    return 0;
+}
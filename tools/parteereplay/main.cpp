@@ -0,0 +1,230 @@
+#include "engine/rendering/core/RenderTrace.hpp"
+#include "engine/rendering/renderables/RenderMesh.hpp"
+#include "engine/rendering/renderables/RenderParticles.hpp"
+#include "engine/rendering/renderables/RenderQuad.hpp"
+#include "engine/rendering/renderers/NullRenderer.hpp"
+#include "engine/rendering/renderers/SoftwareRenderer.hpp"
+#include "engine/rendering/renderers/software/Framebuffer.hpp"
+#include "engine/rendering/windows/OffscreenWindow.hpp"
+#include "engine/util/TypeName.hpp"
+#if defined(PARTEE_GL_CORE)
+#include "engine/rendering/renderers/GLCoreRenderer.hpp"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace parteeengine;
+using namespace parteeengine::rendering;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    double millisecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    struct Options {
+        std::string renderer = "software";
+        std::string tracePath;
+        std::string screenshotPath;
+        int repeat = 1;
+    };
+
+    // Totals over every replayed frame
+    struct Timing {
+        double total = 0.0;
+        double max = 0.0;
+
+        void add(double milliseconds) {
+            total += milliseconds;
+            max = std::max(max, milliseconds);
+        }
+    };
+
+    struct BucketStats {
+        uint64_t commands = 0;
+        uint64_t runs = 0;
+        Timing handler;       // Per frame: every handler call for the bucket's type
+        double frameHandler = 0.0;
+    };
+
+    // Keyed by command type name, so the report comes out in a stable order
+    using Stats = std::map<std::string, BucketStats>;
+
+    // Registers fn for the renderer, timed into the command type's stats.
+    template<typename Renderer, typename CommandType>
+    void registerTimed(Renderer& renderer, Stats& stats, RenderFunction<Renderer, CommandType> fn) {
+        BucketStats* bucketStats = &stats[readableTypeName(typeid(CommandType))];
+        renderer.template registerHandler<CommandType>(RenderFunction<Renderer, CommandType>(
+            [fn, bucketStats](std::span<const CommandType> commands, const RenderContext<Renderer>& context) {
+                const Clock::time_point start = Clock::now();
+                if (fn) {
+                    fn(commands, context);
+                }
+                bucketStats->frameHandler += millisecondsSince(start);
+            }));
+    }
+
+    template<typename Renderer>
+    int replay(Renderer& renderer, Stats& stats, const Options& options) {
+        RenderTraceReader reader;
+        reader.registerType<QuadRenderCommand>();
+        reader.registerType<StaticQuadBatchCommand>();
+        reader.registerType<MeshRenderCommand>();
+        reader.registerType<ParticleBatchRenderCommand>();
+
+        OffscreenWindow window;
+        RenderFrame frame;
+        Timing sortTime, renderTime;
+        uint64_t frames = 0;
+        bool initialized = false;
+
+        for (int pass = 0; pass < options.repeat; ++pass) {
+            if (!reader.open(options.tracePath)) {
+                std::cerr << "Not a render trace from this build: " << options.tracePath << "\n";
+                return 1;
+            }
+            int width = 0, height = 0;
+            while (reader.nextFrame(frame, width, height)) {
+                WindowConfig config = window.getConfig();
+                if (!initialized) {
+                    config.width = width;
+                    config.height = height;
+                    window.create(config);
+                    if (!renderer.initialize(window)) {
+                        std::cerr << "Failed to initialize the " << options.renderer << " renderer\n";
+                        return 1;
+                    }
+                    initialized = true;
+                } else if (config.width != width || config.height != height) {
+                    window.resize(width, height);
+                    window.pollEvents();
+                }
+
+                Clock::time_point start = Clock::now();
+                frame.sort();
+                sortTime.add(millisecondsSince(start));
+
+                for (auto& [name, bucketStats] : stats) {
+                    bucketStats.frameHandler = 0.0;
+                }
+                for (const auto& bucket : frame.getBuckets()) {
+                    stats[bucket->getName()].commands += bucket->size();
+                }
+                for (const RenderRun& run : frame.getRuns()) {
+                    ++stats[frame.getBuckets()[run.bucket]->getName()].runs;
+                }
+
+                start = Clock::now();
+                renderer.render(frame, window);
+                renderTime.add(millisecondsSince(start));
+                window.swapBuffers();
+
+                for (auto& [name, bucketStats] : stats) {
+                    bucketStats.handler.add(bucketStats.frameHandler);
+                }
+                ++frames;
+            }
+        }
+
+        if (frames == 0) {
+            std::cerr << "No frames in " << options.tracePath << "\n";
+            return 1;
+        }
+        if (reader.getSkippedCommandCount() > 0) {
+            std::cerr << "Skipped " << reader.getSkippedCommandCount() << " commands of types this tool doesn't know\n";
+        }
+
+        const double n = static_cast<double>(frames);
+        std::printf("Replayed %llu frames with the %s renderer\n", static_cast<unsigned long long>(frames), options.renderer.c_str());
+        std::printf("  sort    avg %8.3f ms  max %8.3f ms\n", sortTime.total / n, sortTime.max);
+        std::printf("  render  avg %8.3f ms  max %8.3f ms\n", renderTime.total / n, renderTime.max);
+        std::printf("\n  %-48s %12s %10s %12s %12s\n", "bucket", "cmds/frame", "runs/frame", "handler avg", "handler max");
+        for (const auto& [name, bucketStats] : stats) {
+            if (bucketStats.commands == 0) {
+                continue;
+            }
+            std::printf("  %-48s %12.1f %10.1f %9.3f ms %9.3f ms\n", name.c_str(),
+                static_cast<double>(bucketStats.commands) / n, static_cast<double>(bucketStats.runs) / n,
+                bucketStats.handler.total / n, bucketStats.handler.max);
+        }
+
+        if (!options.screenshotPath.empty()) {
+            std::span<const uint32_t> pixels = window.getFrontBuffer();
+            rendering::software::Framebuffer image;
+            image.resize(window.getConfig().width, window.getConfig().height);
+            std::copy(pixels.begin(), pixels.end(), image.data());
+            if (!image.write(options.screenshotPath)) {
+                std::cerr << "Failed to write screenshot " << options.screenshotPath << "\n";
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+} // namespace
+
+// Usage: parteereplay [--software | --gl-core | --null] [--repeat N] [--screenshot FILE] TRACE
+// Feeds a render trace recorded with `parteeeengine --trace FILE` to a renderer and
+// reports the sort, render and per-bucket handler times. Times are CPU wall time;
+// GL core frames include reading the image back into the offscreen window.
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--software") {
+            options.renderer = "software";
+        } else if (arg == "--gl-core") {
+            options.renderer = "gl-core";
+        } else if (arg == "--null") {
+            options.renderer = "null";
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            options.repeat = std::max(std::stoi(argv[++i]), 1);
+        } else if (arg == "--screenshot" && i + 1 < argc) {
+            options.screenshotPath = argv[++i];
+        } else {
+            options.tracePath = arg;
+        }
+    }
+    if (options.tracePath.empty()) {
+        std::cerr << "Usage: parteereplay [--software | --gl-core | --null] [--repeat N] [--screenshot FILE] TRACE\n";
+        return 1;
+    }
+
+    Stats stats;
+    if (options.renderer == "software") {
+        SoftwareRenderer renderer;
+        registerTimed(renderer, stats, RenderQuadComponent::softwareHandler());
+        registerTimed(renderer, stats, RenderQuadComponent::staticBatchSoftwareHandler());
+        registerTimed(renderer, stats, RenderMeshComponent::softwareHandler());
+        registerTimed(renderer, stats, RenderParticles::softwareHandler());
+        return replay(renderer, stats, options);
+    }
+    if (options.renderer == "null") {
+        // Handlers do nothing, which times dispatch alone
+        NullRenderer renderer;
+        registerTimed(renderer, stats, RenderFunction<NullRenderer, QuadRenderCommand>());
+        registerTimed(renderer, stats, RenderFunction<NullRenderer, StaticQuadBatchCommand>());
+        registerTimed(renderer, stats, RenderFunction<NullRenderer, MeshRenderCommand>());
+        registerTimed(renderer, stats, RenderFunction<NullRenderer, ParticleBatchRenderCommand>());
+        return replay(renderer, stats, options);
+    }
+#if defined(PARTEE_GL_CORE)
+    GLCoreRenderer renderer;
+    registerTimed(renderer, stats, RenderQuadComponent::glCoreHandler());
+    registerTimed(renderer, stats, RenderQuadComponent::staticBatchGLCoreHandler());
+    registerTimed(renderer, stats, RenderMeshComponent::glCoreHandler());
+    registerTimed(renderer, stats, RenderParticles::glCoreHandler());
+    return replay(renderer, stats, options);
+#else
+    std::cerr << "Built without the OpenGL core renderer\n";
+    return 1;
+#endif
+}